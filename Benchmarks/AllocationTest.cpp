@@ -0,0 +1,42 @@
+/**
+* @file AllocationTest.cpp
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Checks that advanceGeneration() makes no heap allocations once a GA has warmed up
+*
+* Global operator new is replaced in this file (see AllocationCounter.h), so
+* every allocation is counted. Each test GA runs with every combination of
+* double buffering and contiguous storage (see runAllocationTest()).
+*
+*	AllocationTest                   Returns 0 if no allocations were made, 1 otherwise
+*
+* Release builds run this after linking, so a regression fails the build.
+*
+* @see (link to GitHub)
+*/
+
+// Must come before anything else is included
+#define GA_COUNT_ALLOCATIONS
+#include "AllocationCounter.h"
+
+#include <iostream>
+
+#include "GeneticAlgorithm.h"
+#include "ChromoTestFeatures.h"
+#include "ChromoKnapsack.h"
+
+int main()
+{
+	// Fixed seed, so a failure can be repeated
+	const ga::RandomGenerator randomGenerator(ga::RandomEngine::xoshiro256ss, 42);
+
+	bool isPassed{ true };
+	isPassed &= ga::runAllocationTest<ga::ChromoTestFeatures>(randomGenerator);
+	isPassed &= ga::runAllocationTest<ga::ChromoKnapsack>(randomGenerator);
+
+	if (!isPassed) {
+		std::cout << "\nERROR: advanceGeneration() allocated memory after warming up.\n\n";
+		return 1;
+	}
+	return 0;
+}
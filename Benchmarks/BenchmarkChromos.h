@@ -0,0 +1,545 @@
+/**
+* @class BenchmarkChromos.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains standard test problems as Chromos, with genome sizes chosen at compile time
+*
+* Each Chromo is a template on its problem size, so the same problem can be
+* run on a small genome and on a large one:
+*
+*	ChromoOneMax<Bits>              Maximize the number of 1 bits
+*	ChromoRandomKnapsack<Items>     Knapsack with generated items, half of the total weight allowed
+*	ChromoRastrigin<Dimensions>     Minimize the Rastrigin function on floats
+*	ChromoRosenbrock<Dimensions>    Minimize the Rosenbrock function on floats
+*	ChromoTSP<Cities>               Shortest tour of generated cities, as a permutation
+*	ChromoSudoku<BoxSize>           Fill an N x N sudoku, where N = BoxSize * BoxSize
+*
+* Every Chromo is a view of its encoded data (see GenomeSchema.h), and
+* problem data (items, cities) is generated once from a fixed seed and
+* shared by every Chromo. Scores are always above 0, and higher is better.
+* Chromos with an initial state of 0 start blank, others start random.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef BENCHMARK_CHROMOS_H_
+#define BENCHMARK_CHROMOS_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "GenomeSchema.h"
+
+namespace ga
+{
+	namespace benchmark
+	{
+		// Seed for generated problem data, so every run solves the same problem
+		const std::uint64_t problemSeed{ 0x5EED5EED5EED5EEDULL };
+
+		/**
+		*	@brief  Replaces a non-finite value with t_min, then clamps it to [t_min, t_max].
+		*	Bit mutations can turn a float into NaN or infinity, which clamp() lets through.
+		*
+		*	@param  t_value specifies the value to limit
+		*	@param  t_min specifies the minimum value to allow
+		*	@param  t_max specifies the maximum value to allow
+		*	@return limited value
+		*/
+		inline float limitFloat(const float t_value, const float t_min, const float t_max)
+		{
+			return std::isfinite(t_value) ? clamp(t_value, t_min, t_max) : t_min;
+		}
+
+		/**
+		*	@brief  Fills each float of a view with a random value in [t_min, t_max).
+		*
+		*	@param  t_values specifies the view to fill
+		*	@param  t_min specifies the minimum value
+		*	@param  t_max specifies the maximum value
+		*	@param  t_randomGenerator is the random number generator to use
+		*	@return void
+		*/
+		template <typename V>
+		void fillRandomFloats(V&& t_values, const float t_min, const float t_max, RandomGenerator& t_randomGenerator)
+		{
+			for (std::size_t i{ 0 }; i < t_values.size(); ++i) {
+				t_values[i] = static_cast<float>(randomRangeDouble(t_min, t_max, t_randomGenerator));
+			}
+		}
+
+		/**
+		*	@brief  Moves a few random floats of a view by up to 1/20 of their range, staying inside it.
+		*	Custom mutations happen after limits are applied, so they must stay in range themselves.
+		*
+		*	@param  t_values specifies the view to mutate
+		*	@param  t_min specifies the minimum value
+		*	@param  t_max specifies the maximum value
+		*	@param  t_randomGenerator is the random number generator to use
+		*	@return void
+		*/
+		template <typename V>
+		void nudgeRandomFloats(V&& t_values, const float t_min, const float t_max, RandomGenerator& t_randomGenerator)
+		{
+			const double step{ (t_max - t_min) / 20.0 };
+			for (int n{ 0 }; n < 4; ++n)
+			{
+				const std::size_t i{ t_randomGenerator.nextIndex(t_values.size()) };
+				t_values[i] = limitFloat(static_cast<float>(t_values[i] + randomRangeDouble(-step, step, t_randomGenerator)), t_min, t_max);
+			}
+		}
+	} // namespace benchmark
+
+	/**
+	*	@brief  OneMax: the score is the number of 1 bits, plus 1.
+	*/
+	template <std::size_t Bits>
+	struct OneMaxBits : GenomeBits<Bits>
+	{
+		static const char* name() { return "Bits"; }
+	};
+
+	template <std::size_t Bits>
+	class ChromoOneMax : public SchemaChromo<GenomeSchema<OneMaxBits<Bits>>, true>
+	{
+	public:
+		using Base = SchemaChromo<GenomeSchema<OneMaxBits<Bits>>, true>;
+
+		explicit ChromoOneMax(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
+			: Base(t_initialStateId, t_randomGenerator)
+		{
+			if (t_initialStateId != 0) {
+				this->m_randomGenerator.fillRandomBits(reinterpret_cast<unsigned char*>(this->m_encoded.data()), OneMaxBits<Bits>::bytes);
+			}
+		};
+		~ChromoOneMax() {};
+
+		void runFitnessFunctionLocal()
+		{
+			// Count 64 bits at a time
+			const unsigned char* bytes{ this->template getValues<OneMaxBits<Bits>>().data() };
+			std::size_t ones{ 0 };
+			std::size_t i{ 0 };
+			for (; i + 8 <= OneMaxBits<Bits>::bytes; i += 8)
+			{
+				std::uint64_t word;
+				std::memcpy(&word, bytes + i, 8);
+				ones += std::bitset<64>(word).count();
+			}
+			for (; i < OneMaxBits<Bits>::bytes; ++i) {
+				ones += std::bitset<8>(bytes[i]).count();
+			}
+			// Padding bits of the last byte do not count
+			if (Bits % 8 != 0) {
+				ones -= std::bitset<8>(bytes[OneMaxBits<Bits>::bytes - 1] >> (Bits % 8)).count();
+			}
+			this->setScore(static_cast<double>(ones + 1));
+		};
+
+		void mutateCustom() {};
+		static bool hasCustomMutations() { return false; };
+
+		friend std::ostream& operator<<(std::ostream& t_output, const ChromoOneMax& self) {
+			t_output << Bits << " bits\t Score = " << self.getScore();
+			return t_output;
+		};
+	};
+
+	/**
+	*	@brief  Knapsack: the score is the value of the items taken, plus 1, or 0 if they weigh too much.
+	*	Weights and values are generated in [1, 100], and the bag holds half of the total weight.
+	*/
+	template <std::size_t Items>
+	struct RandomKnapsackItems : GenomeBits<Items>
+	{
+		static const char* name() { return "Items"; }
+	};
+
+	template <std::size_t Items>
+	struct RandomKnapsackProblem
+	{
+		std::array<std::int32_t, Items> weights;
+		std::array<std::int32_t, Items> values;
+		std::int64_t capacity;
+
+		RandomKnapsackProblem()
+		{
+			RandomGenerator randomGenerator(RandomEngine::xoshiro256ss, benchmark::problemSeed);
+			std::int64_t totalWeight{ 0 };
+			for (std::size_t i{ 0 }; i < Items; ++i)
+			{
+				weights[i] = static_cast<std::int32_t>(randomGenerator.nextIndex(100) + 1);
+				values[i] = static_cast<std::int32_t>(randomGenerator.nextIndex(100) + 1);
+				totalWeight += weights[i];
+			}
+			capacity = totalWeight / 2;
+		};
+
+		// Built on first use, then shared by every Chromo
+		static const RandomKnapsackProblem& get()
+		{
+			static const RandomKnapsackProblem problem;
+			return problem;
+		};
+	};
+
+	template <std::size_t Items>
+	class ChromoRandomKnapsack : public SchemaChromo<GenomeSchema<RandomKnapsackItems<Items>>, true>
+	{
+	public:
+		using Base = SchemaChromo<GenomeSchema<RandomKnapsackItems<Items>>, true>;
+
+		explicit ChromoRandomKnapsack(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
+			: Base(t_initialStateId, t_randomGenerator)
+		{
+			RandomKnapsackProblem<Items>::get();
+			if (t_initialStateId != 0)
+			{
+				// Take about 1 in 4 items, so most starting bags are under the limit
+				unsigned char* bytes{ reinterpret_cast<unsigned char*>(this->m_encoded.data()) };
+				for (std::size_t i{ 0 }; i < RandomKnapsackItems<Items>::bytes; ++i) {
+					bytes[i] = static_cast<unsigned char>(this->m_randomGenerator.nextU32() & this->m_randomGenerator.nextU32());
+				}
+			}
+		};
+		~ChromoRandomKnapsack() {};
+
+		void runFitnessFunctionLocal()
+		{
+			const RandomKnapsackProblem<Items>& problem{ RandomKnapsackProblem<Items>::get() };
+			const unsigned char* bytes{ this->template getValues<RandomKnapsackItems<Items>>().data() };
+			// No branches, so the compiler can vectorize the sums
+			std::int64_t weight{ 0 };
+			std::int64_t value{ 0 };
+			for (std::size_t i{ 0 }; i < Items; ++i)
+			{
+				const std::int32_t isTaken{ (bytes[i / 8] >> (i % 8)) & 1 };
+				weight += isTaken * problem.weights[i];
+				value += isTaken * problem.values[i];
+			}
+			this->setScore(weight <= problem.capacity ? static_cast<double>(value + 1) : 0.0);
+		};
+
+		void mutateCustom() {};
+		static bool hasCustomMutations() { return false; };
+
+		friend std::ostream& operator<<(std::ostream& t_output, const ChromoRandomKnapsack& self) {
+			t_output << Items << " items\t Score = " << self.getScore();
+			return t_output;
+		};
+	};
+
+	/**
+	*	@brief  Rastrigin: the score is 1 / (1 + f(x)), where f has its minimum of 0 at x = 0.
+	*	f(x) = 10n + sum(x_i^2 - 10cos(2 pi x_i)), for x_i in [-5.12, 5.12].
+	*/
+	template <std::size_t Dimensions>
+	struct RastriginValues : GenomeField<float, Dimensions>
+	{
+		static const char* name() { return "X"; }
+	};
+
+	template <std::size_t Dimensions>
+	class ChromoRastrigin : public SchemaChromo<GenomeSchema<RastriginValues<Dimensions>>, true>
+	{
+	public:
+		using Base = SchemaChromo<GenomeSchema<RastriginValues<Dimensions>>, true>;
+
+		explicit ChromoRastrigin(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
+			: Base(t_initialStateId, t_randomGenerator)
+		{
+			auto x = this->template getValues<RastriginValues<Dimensions>>();
+			if (t_initialStateId != 0) {
+				benchmark::fillRandomFloats(x, -bound(), bound(), this->m_randomGenerator);
+			}
+			else {
+				std::fill(x.begin(), x.end(), bound());
+			}
+		};
+		~ChromoRastrigin() {};
+
+		void runFitnessFunctionLocal()
+		{
+			const double twoPi{ 6.283185307179586 };
+			const auto x = this->template getValues<RastriginValues<Dimensions>>();
+			double f{ 10.0 * Dimensions };
+			for (std::size_t i{ 0 }; i < Dimensions; ++i) {
+				f += static_cast<double>(x[i]) * x[i] - 10.0 * std::cos(twoPi * x[i]);
+			}
+			this->setScore(1.0 / (1.0 + f));
+		};
+
+		void mutateCustom()
+		{
+			benchmark::nudgeRandomFloats(this->template getValues<RastriginValues<Dimensions>>(), -bound(), bound(), this->m_randomGenerator);
+		};
+		static bool hasCustomMutations() { return true; };
+
+		void applyLimits()
+		{
+			auto x = this->template getValues<RastriginValues<Dimensions>>();
+			for (std::size_t i{ 0 }; i < Dimensions; ++i) {
+				x[i] = benchmark::limitFloat(x[i], -bound(), bound());
+			}
+		};
+
+		friend std::ostream& operator<<(std::ostream& t_output, const ChromoRastrigin& self) {
+			t_output << Dimensions << " dimensions\t Score = " << self.getScore();
+			return t_output;
+		};
+
+	private:
+		static float bound() { return 5.12f; };
+	};
+
+	/**
+	*	@brief  Rosenbrock: the score is 1 / (1 + f(x)), where f has its minimum of 0 at x = 1.
+	*	f(x) = sum(100(x_i+1 - x_i^2)^2 + (1 - x_i)^2), for x_i in [-2.048, 2.048].
+	*/
+	template <std::size_t Dimensions>
+	struct RosenbrockValues : GenomeField<float, Dimensions>
+	{
+		static const char* name() { return "X"; }
+	};
+
+	template <std::size_t Dimensions>
+	class ChromoRosenbrock : public SchemaChromo<GenomeSchema<RosenbrockValues<Dimensions>>, true>
+	{
+		static_assert(Dimensions >= 2, "Rosenbrock needs at least 2 dimensions");
+
+	public:
+		using Base = SchemaChromo<GenomeSchema<RosenbrockValues<Dimensions>>, true>;
+
+		explicit ChromoRosenbrock(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
+			: Base(t_initialStateId, t_randomGenerator)
+		{
+			auto x = this->template getValues<RosenbrockValues<Dimensions>>();
+			if (t_initialStateId != 0) {
+				benchmark::fillRandomFloats(x, -bound(), bound(), this->m_randomGenerator);
+			}
+			else {
+				std::fill(x.begin(), x.end(), -bound());
+			}
+		};
+		~ChromoRosenbrock() {};
+
+		void runFitnessFunctionLocal()
+		{
+			const auto x = this->template getValues<RosenbrockValues<Dimensions>>();
+			double f{ 0.0 };
+			for (std::size_t i{ 0 }; i + 1 < Dimensions; ++i)
+			{
+				const double a{ static_cast<double>(x[i + 1]) - static_cast<double>(x[i]) * x[i] };
+				const double b{ 1.0 - x[i] };
+				f += 100.0 * a * a + b * b;
+			}
+			this->setScore(1.0 / (1.0 + f));
+		};
+
+		void mutateCustom()
+		{
+			benchmark::nudgeRandomFloats(this->template getValues<RosenbrockValues<Dimensions>>(), -bound(), bound(), this->m_randomGenerator);
+		};
+		static bool hasCustomMutations() { return true; };
+
+		void applyLimits()
+		{
+			auto x = this->template getValues<RosenbrockValues<Dimensions>>();
+			for (std::size_t i{ 0 }; i < Dimensions; ++i) {
+				x[i] = benchmark::limitFloat(x[i], -bound(), bound());
+			}
+		};
+
+		friend std::ostream& operator<<(std::ostream& t_output, const ChromoRosenbrock& self) {
+			t_output << Dimensions << " dimensions\t Score = " << self.getScore();
+			return t_output;
+		};
+
+	private:
+		static float bound() { return 2.048f; };
+	};
+
+	/**
+	*	@brief  Travelling salesman: the score is the number of cities divided by the tour length.
+	*	Cities are generated in the unit square. The tour is encoded as
+	*	random keys: a float per city, where the cities are visited in
+	*	order of their keys. Every encoding is then a valid tour, so
+	*	crossovers and mutations need no repair.
+	*/
+	template <std::size_t Cities>
+	struct TSPKeys : GenomeField<float, Cities>
+	{
+		static const char* name() { return "Keys"; }
+	};
+
+	template <std::size_t Cities>
+	struct TSPProblem
+	{
+		std::array<float, Cities> x;
+		std::array<float, Cities> y;
+
+		TSPProblem()
+		{
+			RandomGenerator randomGenerator(RandomEngine::xoshiro256ss, benchmark::problemSeed);
+			for (std::size_t i{ 0 }; i < Cities; ++i)
+			{
+				x[i] = static_cast<float>(randomGenerator.nextDouble());
+				y[i] = static_cast<float>(randomGenerator.nextDouble());
+			}
+		};
+
+		static const TSPProblem& get()
+		{
+			static const TSPProblem problem;
+			return problem;
+		};
+	};
+
+	template <std::size_t Cities>
+	class ChromoTSP : public SchemaChromo<GenomeSchema<TSPKeys<Cities>>, true>
+	{
+		static_assert(Cities >= 2 && Cities <= 65536, "City indices are stored as 16 bits");
+
+	public:
+		using Base = SchemaChromo<GenomeSchema<TSPKeys<Cities>>, true>;
+
+		explicit ChromoTSP(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
+			: Base(t_initialStateId, t_randomGenerator)
+		{
+			TSPProblem<Cities>::get();
+			auto keys = this->template getValues<TSPKeys<Cities>>();
+			if (t_initialStateId != 0) {
+				benchmark::fillRandomFloats(keys, 0.0f, 1.0f, this->m_randomGenerator);
+			}
+			else {
+				// Visit the cities in order
+				for (std::size_t i{ 0 }; i < Cities; ++i) {
+					keys[i] = static_cast<float>(i) / Cities;
+				}
+			}
+		};
+		~ChromoTSP() {};
+
+		void runFitnessFunctionLocal()
+		{
+			const TSPProblem<Cities>& problem{ TSPProblem<Cities>::get() };
+			const auto keys = this->template getValues<TSPKeys<Cities>>();
+
+			// Sort the cities by key, on the stack so nothing is allocated
+			std::array<std::uint16_t, Cities> tour;
+			for (std::size_t i{ 0 }; i < Cities; ++i) {
+				tour[i] = static_cast<std::uint16_t>(i);
+			}
+			std::sort(tour.begin(), tour.end(), [&keys](const std::uint16_t t_city1, const std::uint16_t t_city2) {
+				return keys[t_city1] < keys[t_city2];
+			});
+
+			double length{ 0.0 };
+			for (std::size_t i{ 0 }; i < Cities; ++i)
+			{
+				const std::size_t from{ tour[i] };
+				const std::size_t to{ tour[(i + 1) % Cities] };
+				const double dx{ static_cast<double>(problem.x[to]) - problem.x[from] };
+				const double dy{ static_cast<double>(problem.y[to]) - problem.y[from] };
+				length += std::sqrt(dx * dx + dy * dy);
+			}
+			this->setScore(length > 0.0 ? Cities / length : 1.0);
+		};
+
+		void mutateCustom() {};
+		static bool hasCustomMutations() { return false; };
+
+		// Keys must be finite, or they cannot be sorted
+		void applyLimits()
+		{
+			auto keys = this->template getValues<TSPKeys<Cities>>();
+			for (std::size_t i{ 0 }; i < Cities; ++i) {
+				keys[i] = benchmark::limitFloat(keys[i], 0.0f, 1.0f);
+			}
+		};
+
+		friend std::ostream& operator<<(std::ostream& t_output, const ChromoTSP& self) {
+			t_output << Cities << " cities\t Score = " << self.getScore();
+			return t_output;
+		};
+	};
+
+	/**
+	*	@brief  N x N sudoku: the score is the number of repeated values in every row, column and box,
+	*	subtracted from the most there could be, plus 1. Values are wrapped into [0, N - 1].
+	*/
+	template <std::size_t BoxSize>
+	struct SudokuCells : GenomeField<unsigned char, BoxSize * BoxSize * BoxSize * BoxSize>
+	{
+		static const char* name() { return "Sudoku"; }
+	};
+
+	template <std::size_t BoxSize>
+	class ChromoSudoku : public SchemaChromo<GenomeSchema<SudokuCells<BoxSize>>, true>
+	{
+		static_assert(BoxSize >= 2 && BoxSize <= 8, "Each row must fit a 64 bit mask");
+
+	public:
+		using Base = SchemaChromo<GenomeSchema<SudokuCells<BoxSize>>, true>;
+		static const std::size_t sideLength{ BoxSize * BoxSize };
+
+		explicit ChromoSudoku(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
+			: Base(t_initialStateId, t_randomGenerator)
+		{
+			auto cells = this->template getValues<SudokuCells<BoxSize>>();
+			for (std::size_t i{ 0 }; i < cells.size(); ++i) {
+				cells[i] = static_cast<unsigned char>(t_initialStateId != 0 ? this->m_randomGenerator.nextIndex(sideLength) : 0);
+			}
+		};
+		~ChromoSudoku() {};
+
+		void runFitnessFunctionLocal()
+		{
+			const auto cells = this->template getValues<SudokuCells<BoxSize>>();
+			std::size_t repeats{ 0 };
+			for (std::size_t unit{ 0 }; unit < sideLength; ++unit)
+			{
+				// Each unit keeps a mask of the values seen so far
+				std::uint64_t rowSeen{ 0 };
+				std::uint64_t columnSeen{ 0 };
+				std::uint64_t boxSeen{ 0 };
+				const std::size_t boxFirst{ (unit / BoxSize) * BoxSize * sideLength + (unit % BoxSize) * BoxSize };
+				for (std::size_t i{ 0 }; i < sideLength; ++i)
+				{
+					const std::uint64_t row{ std::uint64_t{ 1 } << cells[unit * sideLength + i] };
+					const std::uint64_t column{ std::uint64_t{ 1 } << cells[i * sideLength + unit] };
+					const std::uint64_t box{ std::uint64_t{ 1 } << cells[boxFirst + (i / BoxSize) * sideLength + i % BoxSize] };
+					repeats += ((rowSeen & row) != 0) + ((columnSeen & column) != 0) + ((boxSeen & box) != 0);
+					rowSeen |= row;
+					columnSeen |= column;
+					boxSeen |= box;
+				}
+			}
+			this->setScore(static_cast<double>(3 * sideLength * (sideLength - 1) - repeats + 1));
+		};
+
+		void mutateCustom() {};
+		static bool hasCustomMutations() { return false; };
+
+		void applyLimits()
+		{
+			limitVectorModulo(this->template getValues<SudokuCells<BoxSize>>(), static_cast<unsigned char>(0), static_cast<unsigned char>(sideLength - 1));
+		};
+
+		friend std::ostream& operator<<(std::ostream& t_output, const ChromoSudoku& self) {
+			t_output << sideLength << "x" << sideLength << " sudoku\t Score = " << self.getScore();
+			return t_output;
+		};
+	};
+
+} // namespace ga
+
+#endif	// BENCHMARK_CHROMOS_H_
@@ -0,0 +1,446 @@
+/**
+* @file KernelBenchmark.cpp
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Times the encoding, crossover, mutation, limit, and knapsack kernels over a range of genome sizes
+*
+* Results are written as JSON, so that runs can be compared to catch regressions:
+*
+*	KernelBenchmark                  Writes to the console
+*	KernelBenchmark results.json     Writes to a file
+*	KernelBenchmark results.json quick
+*	                                 Uses fewer sizes and shorter timings
+*
+* Each result has the kernel name, the genome size in bytes, the number of
+* calls timed, the time per call (ns/op), and the genome bytes processed per second.
+* Genomes run from 16 bytes to 256 KB, or to 16 MB without "quick".
+*
+* nSplitEncodedData/baseline runs the n-split crossover from before it was
+* rewritten, so the two can be compared at each size.
+*
+* The knapsack kernels are also checked: the AVX2 masked sum must match the
+* scalar one, and totals updated after random bit flips must match totals
+* summed from scratch. A mismatch is reported, and 1 is returned.
+*
+* @see (link to GitHub)
+*/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+#include "ChromoSerialization.h"
+#include "EncodedData.h"
+#include "KnapsackProblem.h"
+#include "MaskedSumKernels.h"
+
+namespace
+{
+	struct BenchmarkResult
+	{
+		std::string name;
+		std::size_t genomeBytes;
+		unsigned long long int iterations;
+		double nsPerOp;
+		double bytesPerSecond;
+	};
+
+	// Results are added to this, so the compiler cannot remove the work being timed
+	volatile std::uint64_t g_sink{ 0 };
+
+	/**
+	*	@brief  Times a kernel, doubling the number of calls until the total time reaches t_minSeconds.
+	*	The kernel is called once first, to warm up caches and allocations.
+	*
+	*	@param  t_results has the new result added to it
+	*	@param  t_name specifies the name of the kernel
+	*	@param  t_genomeBytes specifies the number of genome bytes each call processes
+	*	@param  t_minSeconds specifies the minimum time to measure
+	*	@param  t_kernel is called with no arguments
+	*	@return void
+	*/
+	template <typename F>
+	void runBenchmark(std::vector<BenchmarkResult>& t_results, const std::string t_name, const std::size_t t_genomeBytes,
+		const double t_minSeconds, F t_kernel)
+	{
+		t_kernel();
+
+		unsigned long long int iterations{ 1 };
+		double seconds{ 0.0 };
+		while (true)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (unsigned long long int i{ 0 }; i < iterations; ++i) {
+				t_kernel();
+			}
+			seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			if (seconds >= t_minSeconds || iterations >= (1ULL << 40)) {
+				break;
+			}
+			iterations *= 2;
+		}
+
+		BenchmarkResult result;
+		result.name = t_name;
+		result.genomeBytes = t_genomeBytes;
+		result.iterations = iterations;
+		result.nsPerOp = seconds * 1e9 / static_cast<double>(iterations);
+		result.bytesPerSecond = seconds > 0.0 ? static_cast<double>(t_genomeBytes) * static_cast<double>(iterations) / seconds : 0.0;
+		t_results.push_back(result);
+	}
+
+	/**
+	*	@brief  Fills encoded data with random bytes.
+	*
+	*	@param  t_encoded specifies the data to fill
+	*	@param  t_bytes specifies the number of bytes
+	*	@param  t_randomGenerator is the random number generator to use
+	*	@return void
+	*/
+	void fillRandomBytes(ga::EncodedData& t_encoded, const std::size_t t_bytes, ga::RandomGenerator& t_randomGenerator)
+	{
+		std::vector<unsigned char> bytes(t_bytes);
+		t_randomGenerator.fillRandomBits(bytes.data(), bytes.size());
+		t_encoded.assign(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+	}
+
+	/**
+	*	@brief  The n-split crossover from before it was rewritten, kept as a baseline for nSplitEncodedData().
+	*	Split points come from getUniqueRandomNumbers(), which walks the whole
+	*	genome, and the child is built from substr() copies. The partition
+	*	sizes are fixed to end at the next split, so it copies the same bytes.
+	*
+	*	@param  t_source1 specifies the 1st source string
+	*	@param  t_source2 specifies the 2nd source string
+	*	@param  t_splits specifies the number of split points
+	*	@param  t_randomGenerator is the random number generator to use
+	*	@return the child string
+	*/
+	std::string nSplitEncodedDataBaseline(const std::string& t_source1, const std::string& t_source2, const std::size_t t_splits, ga::RandomGenerator& t_randomGenerator)
+	{
+		std::string result = "";
+		result.reserve(t_source1.length());
+
+		// Split locations refer to the beginning of each partition
+		// The first location is always set to be 0
+		std::vector<std::size_t> splitLocations{ 0 };
+		const std::size_t size1{ 1 };
+		ga::getUniqueRandomNumbers(splitLocations, t_splits, size1, t_source1.length() - size1, t_randomGenerator);
+
+		short int useStringNow{ static_cast<short int>(t_randomGenerator() % 2) };
+		std::size_t locationNow{ 0 };
+		const std::size_t n{ splitLocations.size() };
+		for (std::size_t i{ 0 }; i < n; ++i)
+		{
+			const std::size_t partitionSize{ (i != n - size1) ? splitLocations.at(i + size1) - locationNow : t_source1.length() - locationNow };
+			result += useStringNow ? t_source1.substr(locationNow, partitionSize) : t_source2.substr(locationNow, partitionSize);
+
+			useStringNow = (useStringNow + 1) % 2;
+			locationNow += partitionSize;
+		}
+
+		return result;
+	}
+
+	/**
+	*	@brief  Runs every kernel benchmark on a genome of a given size.
+	*
+	*	@param  t_results has the new results added to it
+	*	@param  t_genomeBytes specifies the genome size in bytes
+	*	@param  t_minSeconds specifies the minimum time to measure each kernel
+	*	@return void
+	*/
+	void runKernelBenchmarks(std::vector<BenchmarkResult>& t_results, const std::size_t t_genomeBytes, const double t_minSeconds)
+	{
+		ga::RandomGenerator randomGenerator(ga::RandomEngine::xoshiro256ss, 12345);
+
+		// Vectors of ints, doubles, and bools that each encode to t_genomeBytes
+		const std::size_t intCount{ t_genomeBytes / sizeof(int) };
+		std::vector<int> ints(intCount);
+		randomGenerator.fillUniformInts(ints.data(), ints.size(), -1000, 1000);
+		std::vector<double> doubles(t_genomeBytes / sizeof(double));
+		randomGenerator.fillUniformDoubles(doubles.data(), doubles.size());
+		std::vector<bool> bools(t_genomeBytes * 8);
+		for (std::size_t i{ 0 }; i < bools.size(); ++i) {
+			bools[i] = (randomGenerator() & 1) != 0;
+		}
+
+		// Encoding
+		std::string encodedInts{ ga::encodeVector(ints) };
+		std::string encodedBools{ ga::encodeBoolVector(bools) };
+		runBenchmark(t_results, "encodeVector<int>", t_genomeBytes, t_minSeconds, [&]() {
+			g_sink = g_sink + ga::encodeVector(ints).length();
+		});
+		ga::EncodedData appended;
+		runBenchmark(t_results, "appendEncodedVector<int>", t_genomeBytes, t_minSeconds, [&]() {
+			appended.clear();
+			ga::appendEncodedVector(appended, ints);
+			g_sink = g_sink + appended.length();
+		});
+		runBenchmark(t_results, "decodeVector<int>", t_genomeBytes, t_minSeconds, [&]() {
+			g_sink = g_sink + ga::decodeVector(ints, encodedInts, 0);
+		});
+		runBenchmark(t_results, "encodeBoolVector", t_genomeBytes, t_minSeconds, [&]() {
+			g_sink = g_sink + ga::encodeBoolVector(bools).length();
+		});
+		runBenchmark(t_results, "appendEncodedBoolVector", t_genomeBytes, t_minSeconds, [&]() {
+			appended.clear();
+			ga::appendEncodedBoolVector(appended, bools);
+			g_sink = g_sink + appended.length();
+		});
+		runBenchmark(t_results, "decodeBoolVector", t_genomeBytes, t_minSeconds, [&]() {
+			g_sink = g_sink + ga::decodeBoolVector(bools, encodedBools, 0);
+		});
+
+		// Crossovers
+		ga::EncodedData parent1;
+		ga::EncodedData parent2;
+		ga::EncodedData child;
+		fillRandomBytes(parent1, t_genomeBytes, randomGenerator);
+		fillRandomBytes(parent2, t_genomeBytes, randomGenerator);
+		runBenchmark(t_results, "shuffleEncodedData/byte", t_genomeBytes, t_minSeconds, [&]() {
+			ga::shuffleEncodedData(parent1, parent2, child, randomGenerator, ga::ShuffleMode::byte);
+			g_sink = g_sink + static_cast<unsigned char>(child[0]);
+		});
+		runBenchmark(t_results, "shuffleEncodedData/bit", t_genomeBytes, t_minSeconds, [&]() {
+			ga::shuffleEncodedData(parent1, parent2, child, randomGenerator, ga::ShuffleMode::bit);
+			g_sink = g_sink + static_cast<unsigned char>(child[0]);
+		});
+		const std::size_t splitCounts[]{ 1, 8, 64 };
+		for (const std::size_t splits : splitCounts)
+		{
+			runBenchmark(t_results, "nSplitEncodedData/" + std::to_string(splits), t_genomeBytes, t_minSeconds, [&]() {
+				ga::nSplitEncodedData(parent1, parent2, child, splits, randomGenerator);
+				g_sink = g_sink + static_cast<unsigned char>(child[0]);
+			});
+		}
+		const std::string baselineParent1(parent1.data(), parent1.length());
+		const std::string baselineParent2(parent2.data(), parent2.length());
+		for (const std::size_t splits : splitCounts)
+		{
+			if (splits >= t_genomeBytes) {
+				continue;
+			}
+			runBenchmark(t_results, "nSplitEncodedData/baseline/" + std::to_string(splits), t_genomeBytes, t_minSeconds, [&]() {
+				g_sink = g_sink + nSplitEncodedDataBaseline(baselineParent1, baselineParent2, splits, randomGenerator).length();
+			});
+		}
+
+		// Mutations, with one partition per int
+		std::vector<ga::EncodedPartition> partitions;
+		for (std::size_t i{ 0 }; i < intCount; ++i) {
+			partitions.push_back(ga::EncodedPartition("ints_" + std::to_string(i), i * sizeof(int), sizeof(int), ga::EncodedPartitionType::normal));
+		}
+		const ga::MutationLimits limits(intCount * sizeof(int), intCount);
+		const ga::MutationSelection selections[]{ ga::MutationSelection::pureRandom, ga::MutationSelection::randomByte, ga::MutationSelection::entirePartition };
+		const char* selectionNames[]{ "pureRandom", "randomByte", "entirePartition" };
+		for (std::size_t i{ 0 }; i < 3; ++i)
+		{
+			const ga::MutationSelection selection{ selections[i] };
+			runBenchmark(t_results, std::string("mutateRandomBits/") + selectionNames[i], t_genomeBytes, t_minSeconds, [&]() {
+				g_sink = g_sink + ga::mutateRandomBits(child, partitions, limits, selection, 16, 8, 0.5, randomGenerator);
+			});
+		}
+
+		// Picking Chromos to mutate, 1 in 10 of a generation the size of the genome
+		std::vector<std::size_t> picks;
+		runBenchmark(t_results, "getUniqueRandomNumbers", t_genomeBytes, t_minSeconds, [&]() {
+			picks.clear();
+			ga::getUniqueRandomNumbers(picks, t_genomeBytes / 10 + 1, static_cast<std::size_t>(0), t_genomeBytes, randomGenerator);
+			g_sink = g_sink + picks.size();
+		});
+		runBenchmark(t_results, "getSortedUniqueRandomNumbers", t_genomeBytes, t_minSeconds, [&]() {
+			ga::getSortedUniqueRandomNumbers(picks, t_genomeBytes / 10 + 1, static_cast<std::size_t>(0), t_genomeBytes, randomGenerator);
+			g_sink = g_sink + picks.size();
+		});
+
+		// Limits
+		// After the first call every value is in range, so this times the usual case of a mostly valid Chromo
+		std::vector<int> limitedInts(ints);
+		runBenchmark(t_results, "limitVector<int>", t_genomeBytes, t_minSeconds, [&]() {
+			ga::limitVector(limitedInts, -500, 500);
+			g_sink = g_sink + static_cast<std::uint64_t>(limitedInts[0]);
+		});
+		runBenchmark(t_results, "limitVectorModulo<int>", t_genomeBytes, t_minSeconds, [&]() {
+			ga::limitVectorModulo(limitedInts, -500, 500);
+			g_sink = g_sink + static_cast<std::uint64_t>(limitedInts[0]);
+		});
+		std::vector<double> limitedDoubles(doubles);
+		runBenchmark(t_results, "limitVectorModuloDouble<double>", t_genomeBytes, t_minSeconds, [&]() {
+			ga::limitVectorModuloDouble(limitedDoubles, 0.25, 0.75);
+			g_sink = g_sink + static_cast<std::uint64_t>(limitedDoubles[0] * 1000.0);
+		});
+	}
+
+	/**
+	*	@brief  Checks and times the knapsack kernels on a random problem with one item per genome bit.
+	*	Weights and values are in [1, 100], and the bag holds half of the total weight.
+	*
+	*	@param  t_results has the new results added to it
+	*	@param  t_genomeBytes specifies the genome size in bytes
+	*	@param  t_minSeconds specifies the minimum time to measure each kernel
+	*	@return true if every kernel gave the same totals as the scalar sums, false otherwise
+	*/
+	bool runKnapsackBenchmarks(std::vector<BenchmarkResult>& t_results, const std::size_t t_genomeBytes, const double t_minSeconds)
+	{
+		ga::RandomGenerator randomGenerator(ga::RandomEngine::xoshiro256ss, 54321);
+
+		const std::size_t itemCount{ t_genomeBytes * 8 };
+		std::vector<std::int32_t> values(itemCount);
+		std::vector<std::int32_t> weights(itemCount);
+		std::int64_t totalWeight{ 0 };
+		for (std::size_t i{ 0 }; i < itemCount; ++i)
+		{
+			values[i] = static_cast<std::int32_t>(randomGenerator.nextIndex(100) + 1);
+			weights[i] = static_cast<std::int32_t>(randomGenerator.nextIndex(100) + 1);
+			totalWeight += weights[i];
+		}
+		ga::KnapsackProblem problem;
+		if (!problem.setItems(itemCount, values.data(), { weights.data() }, { totalWeight / 2 })) {
+			return false;
+		}
+
+		bool isPassed{ true };
+		std::vector<unsigned char> selection(problem.getSelectionBytes());
+		randomGenerator.fillRandomBits(selection.data(), selection.size());
+
+		// Masked sums, on the padded values of the problem
+		const std::int64_t scalarSum{ ga::maskedSumScalar(problem.getValues(), selection.data(), selection.size()) };
+		runBenchmark(t_results, "maskedSum/scalar", t_genomeBytes, t_minSeconds, [&]() {
+			g_sink = g_sink + static_cast<std::uint64_t>(ga::maskedSum(problem.getValues(), selection.data(), selection.size(), ga::SimdLevel::scalar));
+		});
+		if (ga::getSimdLevel() == ga::SimdLevel::avx2)
+		{
+			const std::int64_t avx2Sum{ ga::maskedSum(problem.getValues(), selection.data(), selection.size(), ga::SimdLevel::avx2) };
+			if (avx2Sum != scalarSum)
+			{
+				std::cerr << "\nERROR: AVX2 masked sum of " << itemCount << " items is " << avx2Sum << ", scalar is " << scalarSum << "\n\n";
+				isPassed = false;
+			}
+			runBenchmark(t_results, "maskedSum/avx2", t_genomeBytes, t_minSeconds, [&]() {
+				g_sink = g_sink + static_cast<std::uint64_t>(ga::maskedSum(problem.getValues(), selection.data(), selection.size(), ga::SimdLevel::avx2));
+			});
+		}
+
+		// Totals updated after a few random bit flips, checked against totals summed from scratch
+		const std::size_t totalsCount{ 1 + problem.getDimensionCount() };
+		std::vector<std::int64_t> totals(totalsCount);
+		std::vector<std::int64_t> expectedTotals(totalsCount);
+		std::vector<unsigned char> previousSelection(selection);
+		problem.sumTotals(selection.data(), totals.data());
+		for (int round{ 0 }; round < 100; ++round)
+		{
+			const std::size_t flips{ randomGenerator.nextIndex(16) + 1 };
+			for (std::size_t i{ 0 }; i < flips; ++i)
+			{
+				const std::size_t item{ randomGenerator.nextIndex(itemCount) };
+				selection[item / 8] ^= static_cast<unsigned char>(1 << (item % 8));
+			}
+			problem.updateTotals(previousSelection.data(), selection.data(), totals.data());
+			problem.sumTotals(selection.data(), expectedTotals.data());
+			if (totals != expectedTotals)
+			{
+				std::cerr << "\nERROR: Updated totals of " << itemCount << " items differ from summed totals after " << flips << " bit flips\n\n";
+				isPassed = false;
+				totals = expectedTotals;
+			}
+			previousSelection = selection;
+		}
+
+		runBenchmark(t_results, "KnapsackProblem::sumTotals", t_genomeBytes, t_minSeconds, [&]() {
+			problem.sumTotals(selection.data(), totals.data());
+			g_sink = g_sink + static_cast<std::uint64_t>(totals[0]);
+		});
+		// Flips the same 8 items each call, in both selections, so the update always covers 8 changes
+		std::size_t flippedItems[8];
+		for (std::size_t& item : flippedItems) {
+			item = randomGenerator.nextIndex(itemCount);
+		}
+		runBenchmark(t_results, "KnapsackProblem::updateTotals/8", t_genomeBytes, t_minSeconds, [&]() {
+			for (const std::size_t item : flippedItems) {
+				selection[item / 8] ^= static_cast<unsigned char>(1 << (item % 8));
+			}
+			problem.updateTotals(previousSelection.data(), selection.data(), totals.data());
+			for (const std::size_t item : flippedItems) {
+				previousSelection[item / 8] ^= static_cast<unsigned char>(1 << (item % 8));
+			}
+			g_sink = g_sink + static_cast<std::uint64_t>(totals[0]);
+		});
+		return isPassed;
+	}
+
+	/**
+	*	@brief  Writes results as a JSON object.
+	*
+	*	@param  t_output is the output stream
+	*	@param  t_results specifies the results to write
+	*	@return void
+	*/
+	void writeResultsAsJSON(std::ostream& t_output, const std::vector<BenchmarkResult>& t_results)
+	{
+		t_output << "{\n";
+#ifdef NDEBUG
+		t_output << "  \"build\": \"release\",\n";
+#else
+		t_output << "  \"build\": \"debug\",\n";
+#endif
+		t_output << "  \"simdLevel\": " << static_cast<int>(ga::getSimdLevel()) << ",\n";
+		t_output << "  \"benchmarks\": [\n";
+		for (std::size_t i{ 0 }; i < t_results.size(); ++i)
+		{
+			const BenchmarkResult& result{ t_results.at(i) };
+			t_output << "    { \"name\": \"" << result.name << "\""
+				<< ", \"genomeBytes\": " << result.genomeBytes
+				<< ", \"iterations\": " << result.iterations
+				<< ", \"nsPerOp\": " << result.nsPerOp
+				<< ", \"bytesPerSecond\": " << result.bytesPerSecond << " }"
+				<< (i + 1 < t_results.size() ? ",\n" : "\n");
+		}
+		t_output << "  ]\n}\n";
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	const bool isQuick{ argc > 2 && std::string(argv[2]) == "quick" };
+	const double minSeconds{ isQuick ? 0.01 : 0.1 };
+	std::vector<std::size_t> genomeSizes{ 16, 64, 1024, 16384, 262144 };
+	if (!isQuick)
+	{
+		genomeSizes.push_back(4194304);
+		genomeSizes.push_back(16777216);
+	}
+
+	// Larger knapsacks take 8 bytes of items per genome bit, too much for 4 MB genomes
+	const std::size_t maxKnapsackBytes{ 262144 };
+
+	std::vector<BenchmarkResult> results;
+	bool isPassed{ true };
+	for (const std::size_t genomeBytes : genomeSizes)
+	{
+		// Progress goes to the error stream, so the console output stays valid JSON
+		std::cerr << "Genome size " << genomeBytes << " bytes...\n";
+		runKernelBenchmarks(results, genomeBytes, minSeconds);
+		if (genomeBytes <= maxKnapsackBytes) {
+			isPassed &= runKnapsackBenchmarks(results, genomeBytes, minSeconds);
+		}
+	}
+
+	if (argc > 1)
+	{
+		std::ofstream oStream(argv[1]);
+		if (!oStream.is_open()) {
+			std::cerr << "\nERROR: Unable to open file " << argv[1] << "\n\n";
+			return 1;
+		}
+		writeResultsAsJSON(oStream, results);
+	}
+	else {
+		writeResultsAsJSON(std::cout, results);
+	}
+	return isPassed ? 0 : 1;
+}
@@ -0,0 +1,268 @@
+/**
+* @file ScalingBenchmark.cpp
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Runs whole generations of the benchmark Chromos, sweeping population size, genome size, and thread count
+*
+* Results are written as CSV, one row per run:
+*
+*	ScalingBenchmark                      Writes to ScalingBenchmark.csv
+*	ScalingBenchmark results.csv          Writes to a file
+*	ScalingBenchmark results.csv quick    Uses fewer sizes and shorter timings
+*
+* Each row has the problem, genome size in bytes, population size,
+* thread count, the number of generations timed, generations per second,
+* and fitness evaluations per second. Every run uses contiguous storage
+* and double buffering. Runs with more than one thread also score and
+* select Chromos on the thread pool.
+*
+* LargeKnapsack runs ChromoLargeKnapsack on the same kind of items as
+* Knapsack, so scoring only the changed items can be compared with
+* scoring every item. Scores set this way count as fitness evaluations.
+*
+* @see (link to GitHub)
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <memory>
+#include <cstdint>
+
+#include "GeneticAlgorithm.h"
+#include "BenchmarkChromos.h"
+#include "ChromoLargeKnapsack.h"
+
+namespace
+{
+	struct ScalingResult
+	{
+		std::string problem;
+		std::size_t genomeBytes;
+		std::size_t population;
+		std::size_t threads;
+		unsigned long int generations;
+		double seconds;
+		unsigned long long int evaluations;
+	};
+
+	struct ScalingSettings
+	{
+		std::vector<std::size_t> populations;
+		std::vector<std::size_t> threadCounts;
+		// Each run is timed for at least this long, after warming up
+		double minSeconds;
+		// Runs whose two generations would need more memory than this are skipped
+		std::size_t maxPopulationBytes;
+		bool isQuick;
+	};
+
+	/**
+	*	@brief  Returns the genome size of a Chromo, fixed at compile time by its schema.
+	*
+	*	@return genome size in bytes
+	*/
+	template <typename C>
+	std::size_t getGenomeBytes()
+	{
+		return C::Schema::bytes;
+	}
+
+	// ChromoLargeKnapsack takes its size from the items set at run time
+	template <>
+	std::size_t getGenomeBytes<ga::ChromoLargeKnapsack>()
+	{
+		return ga::ChromoLargeKnapsack::getProblem().getSelectionBytes();
+	}
+
+	/**
+	*	@brief  Times whole generations of a GA, for every population size and thread count.
+	*
+	*	@param  t_results has the new results added to it
+	*	@param  t_problem specifies the name of the problem
+	*	@param  t_settings specifies the sizes and thread counts to sweep
+	*	@return void
+	*/
+	template <typename C>
+	void runScaling(std::vector<ScalingResult>& t_results, const std::string t_problem, const ScalingSettings& t_settings)
+	{
+		const std::size_t genomeBytes{ getGenomeBytes<C>() };
+		for (const std::size_t population : t_settings.populations)
+		{
+			if (2 * population * genomeBytes > t_settings.maxPopulationBytes) {
+				continue;
+			}
+			for (const std::size_t threads : t_settings.threadCounts)
+			{
+				ga::GeneticAlgorithm<C> geneticAlgorithm(t_problem, population, 1, ga::RandomGenerator(ga::RandomEngine::xoshiro256ss, 12345));
+				geneticAlgorithm.setNumberToCopy(population / 10);
+				geneticAlgorithm.setNumberToShuffle(population / 5);
+				geneticAlgorithm.setNumberToCrossover(population / 5);
+				geneticAlgorithm.setNumberToMutate(population * 2 / 5);
+				geneticAlgorithm.setNumberOfCrossoverSplits(2);
+				geneticAlgorithm.setMutationCountMax(4);
+				geneticAlgorithm.setMutationBitWidth(8);
+				geneticAlgorithm.setMutationChanceIn100(50);
+				geneticAlgorithm.setContiguousStorage(true);
+				geneticAlgorithm.setDoubleBuffering(true);
+				if (threads > 1)
+				{
+					geneticAlgorithm.setThreadCount(threads);
+					geneticAlgorithm.setParallelFitness(true);
+					geneticAlgorithm.setParallelSelection(true);
+				}
+
+				// Warm up, so that every buffer reaches its full size
+				for (int g{ 0 }; g < 2; ++g) {
+					geneticAlgorithm.advanceGeneration();
+				}
+
+				// Scores set by updateFitness() count as evaluations
+				const unsigned long long int evaluationsBefore{ geneticAlgorithm.getFitnessEvaluationCount() + geneticAlgorithm.getFitnessUpdateCount() };
+				const auto start = std::chrono::steady_clock::now();
+				unsigned long int generations{ 0 };
+				double seconds{ 0.0 };
+				while (seconds < t_settings.minSeconds || generations < 3)
+				{
+					geneticAlgorithm.advanceGeneration();
+					++generations;
+					seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+				}
+
+				ScalingResult result;
+				result.problem = t_problem;
+				result.genomeBytes = genomeBytes;
+				result.population = population;
+				result.threads = threads;
+				result.generations = generations;
+				result.seconds = seconds;
+				result.evaluations = geneticAlgorithm.getFitnessEvaluationCount() + geneticAlgorithm.getFitnessUpdateCount() - evaluationsBefore;
+				t_results.push_back(result);
+
+				std::cout << t_problem << ", " << genomeBytes << " bytes, " << population << " Chromos, " << threads << " threads: "
+					<< generations / seconds << " generations/s, " << result.evaluations / seconds << " evaluations/s\n";
+			}
+		}
+	}
+
+	/**
+	*	@brief  Times ChromoLargeKnapsack on generated items, the same as ChromoRandomKnapsack uses:
+	*	weights and values in [1, 100], and a bag that holds half of the total weight.
+	*
+	*	@param  t_results has the new results added to it
+	*	@param  t_itemCount specifies the number of items
+	*	@param  t_settings specifies the sizes and thread counts to sweep
+	*	@return void
+	*/
+	void runLargeKnapsack(std::vector<ScalingResult>& t_results, const std::size_t t_itemCount, const ScalingSettings& t_settings)
+	{
+		ga::RandomGenerator randomGenerator(ga::RandomEngine::xoshiro256ss, ga::benchmark::problemSeed);
+		std::vector<std::int32_t> weights(t_itemCount);
+		std::vector<std::int32_t> values(t_itemCount);
+		std::int64_t totalWeight{ 0 };
+		for (std::size_t i{ 0 }; i < t_itemCount; ++i)
+		{
+			weights[i] = static_cast<std::int32_t>(randomGenerator.nextIndex(100) + 1);
+			values[i] = static_cast<std::int32_t>(randomGenerator.nextIndex(100) + 1);
+			totalWeight += weights[i];
+		}
+
+		auto problem = std::make_shared<ga::KnapsackProblem>();
+		if (!problem->setItems(t_itemCount, values.data(), { weights.data() }, { totalWeight / 2 })) {
+			return;
+		}
+		ga::ChromoLargeKnapsack::setProblem(problem);
+		runScaling<ga::ChromoLargeKnapsack>(t_results, "LargeKnapsack", t_settings);
+		ga::ChromoLargeKnapsack::setProblem(nullptr);
+	}
+
+	/**
+	*	@brief  Runs every problem at every genome size. Larger genomes are skipped by a quick run.
+	*
+	*	@param  t_results has the new results added to it
+	*	@param  t_settings specifies the sizes and thread counts to sweep
+	*	@return void
+	*/
+	void runAllProblems(std::vector<ScalingResult>& t_results, const ScalingSettings& t_settings)
+	{
+		runScaling<ga::ChromoOneMax<1024>>(t_results, "OneMax", t_settings);
+		runScaling<ga::ChromoOneMax<32768>>(t_results, "OneMax", t_settings);
+		runScaling<ga::ChromoRandomKnapsack<256>>(t_results, "Knapsack", t_settings);
+		runScaling<ga::ChromoRandomKnapsack<8192>>(t_results, "Knapsack", t_settings);
+		runLargeKnapsack(t_results, 8192, t_settings);
+		runScaling<ga::ChromoRastrigin<32>>(t_results, "Rastrigin", t_settings);
+		runScaling<ga::ChromoRastrigin<1024>>(t_results, "Rastrigin", t_settings);
+		runScaling<ga::ChromoRosenbrock<32>>(t_results, "Rosenbrock", t_settings);
+		runScaling<ga::ChromoRosenbrock<1024>>(t_results, "Rosenbrock", t_settings);
+		runScaling<ga::ChromoTSP<64>>(t_results, "TSP", t_settings);
+		runScaling<ga::ChromoTSP<512>>(t_results, "TSP", t_settings);
+		runScaling<ga::ChromoSudoku<3>>(t_results, "Sudoku", t_settings);
+		runScaling<ga::ChromoSudoku<5>>(t_results, "Sudoku", t_settings);
+		if (t_settings.isQuick) {
+			return;
+		}
+		runScaling<ga::ChromoOneMax<1048576>>(t_results, "OneMax", t_settings);
+		runScaling<ga::ChromoRandomKnapsack<131072>>(t_results, "Knapsack", t_settings);
+		runLargeKnapsack(t_results, 131072, t_settings);
+		runLargeKnapsack(t_results, 1048576, t_settings);
+		runScaling<ga::ChromoRastrigin<16384>>(t_results, "Rastrigin", t_settings);
+		runScaling<ga::ChromoRosenbrock<16384>>(t_results, "Rosenbrock", t_settings);
+		runScaling<ga::ChromoTSP<4096>>(t_results, "TSP", t_settings);
+		runScaling<ga::ChromoSudoku<8>>(t_results, "Sudoku", t_settings);
+	}
+
+	/**
+	*	@brief  Writes results as CSV, with a header row.
+	*
+	*	@param  t_output is the output stream
+	*	@param  t_results specifies the results to write
+	*	@return void
+	*/
+	void writeResultsAsCSV(std::ostream& t_output, const std::vector<ScalingResult>& t_results)
+	{
+		t_output << "problem,genomeBytes,population,threads,generations,seconds,generationsPerSecond,evaluationsPerSecond\n";
+		for (const ScalingResult& result : t_results)
+		{
+			t_output << result.problem << "," << result.genomeBytes << "," << result.population << "," << result.threads
+				<< "," << result.generations << "," << result.seconds
+				<< "," << result.generations / result.seconds << "," << result.evaluations / result.seconds << "\n";
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	const std::string fileName{ argc > 1 ? argv[1] : "ScalingBenchmark.csv" };
+
+	ScalingSettings settings;
+	settings.isQuick = argc > 2 && std::string(argv[2]) == "quick";
+	settings.minSeconds = settings.isQuick ? 0.2 : 1.0;
+	settings.maxPopulationBytes = std::size_t{ 512 } * 1024 * 1024;
+	settings.populations = { 100, 1000, 10000 };
+	if (!settings.isQuick) {
+		settings.populations.push_back(100000);
+	}
+
+	// 1, 2, 4... up to the hardware thread count
+	const std::size_t hardwareThreads{ std::max(std::thread::hardware_concurrency(), 1u) };
+	for (std::size_t threads{ 1 }; threads < hardwareThreads; threads *= 2) {
+		settings.threadCounts.push_back(threads);
+	}
+	settings.threadCounts.push_back(hardwareThreads);
+
+	std::vector<ScalingResult> results;
+	runAllProblems(results, settings);
+
+	std::ofstream oStream(fileName);
+	if (!oStream.is_open()) {
+		std::cout << "\nERROR: Unable to open file " << fileName << "\n\n";
+		return 1;
+	}
+	writeResultsAsCSV(oStream, results);
+	std::cout << "\nResults written to " << fileName << "\n";
+	return 0;
+}
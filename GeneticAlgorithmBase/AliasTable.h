@@ -0,0 +1,150 @@
+/**
+* @class AliasTable.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a table for drawing weighted random indices in constant time
+*
+* Uses Vose's alias method. Building the table takes O(n) time, after which
+* each draw takes one random number and one table lookup, no matter how many
+* weights there are. The GA builds one table per generation for roulette and
+* rank selection, then draws every parent from it.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef ALIAS_TABLE_H_
+#define ALIAS_TABLE_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <cstddef>
+
+#include "RandomGenerator.h"
+
+namespace ga
+{
+	class AliasTable
+	{
+	public:
+		AliasTable() {};
+		~AliasTable() {};
+
+		void build(const double*, const std::size_t);
+		std::size_t sample(RandomGenerator&) const;
+		std::size_t size() const;
+
+	private:
+		// Chance of keeping each column rather than taking its alias
+		std::vector<double> m_probability;
+		std::vector<std::size_t> m_alias;
+		// Work lists used while building (kept to avoid reallocating)
+		std::vector<std::size_t> m_small;
+		std::vector<std::size_t> m_large;
+	};
+
+	/**
+	*	@brief  Builds the table from a list of weights. Any previous table is replaced.
+	*	Weights do not need to add up to 1. Negative weights count as 0.
+	*	If every weight is 0, every index is equally likely.
+	*	Memory is only allocated when the table grows.
+	*
+	*	@param  t_weights points to the first weight
+	*	@param  t_count specifies the number of weights
+	*	@return void
+	*/
+	inline void AliasTable::build(const double* t_weights, const std::size_t t_count)
+	{
+		m_probability.resize(t_count);
+		m_alias.resize(t_count);
+		m_small.resize(t_count);
+		m_large.resize(t_count);
+
+		double total{ 0.0 };
+		for (std::size_t i{ 0 }; i < t_count; ++i) {
+			if (t_weights[i] > 0.0) {
+				total += t_weights[i];
+			}
+		}
+
+		if (!(total > 0.0))
+		{
+			// Nothing to weight by, so choose uniformly
+			for (std::size_t i{ 0 }; i < t_count; ++i) {
+				m_probability[i] = 1.0;
+				m_alias[i] = i;
+			}
+			return;
+		}
+
+		// Scale the weights so that their average is 1,
+		// then sort the columns into under-full and over-full
+		const double scale{ static_cast<double>(t_count) / total };
+		std::size_t numSmall{ 0 };
+		std::size_t numLarge{ 0 };
+		for (std::size_t i{ 0 }; i < t_count; ++i)
+		{
+			m_probability[i] = t_weights[i] > 0.0 ? t_weights[i] * scale : 0.0;
+			m_alias[i] = i;
+			if (m_probability[i] < 1.0) {
+				m_small[numSmall++] = i;
+			}
+			else {
+				m_large[numLarge++] = i;
+			}
+		}
+
+		// Fill each under-full column with part of an over-full one
+		while (numSmall > 0 && numLarge > 0)
+		{
+			const std::size_t small{ m_small[--numSmall] };
+			const std::size_t large{ m_large[numLarge - 1] };
+			m_alias[small] = large;
+			m_probability[large] = (m_probability[large] + m_probability[small]) - 1.0;
+			if (m_probability[large] < 1.0) {
+				--numLarge;
+				m_small[numSmall++] = large;
+			}
+		}
+
+		// Anything left over is full, apart from rounding errors
+		while (numLarge > 0) {
+			m_probability[m_large[--numLarge]] = 1.0;
+		}
+		while (numSmall > 0) {
+			m_probability[m_small[--numSmall]] = 1.0;
+		}
+	}
+
+	/**
+	*	@brief  Draws a random index, with a chance proportional to its weight.
+	*	A single random double picks both the column and whether to take its alias.
+	*
+	*	@param  t_randomGenerator is used to make the draw
+	*	@return Random index in [0, size())
+	*/
+	inline std::size_t AliasTable::sample(RandomGenerator& t_randomGenerator) const
+	{
+		const double draw{ t_randomGenerator.nextDouble() * static_cast<double>(m_probability.size()) };
+		std::size_t column{ static_cast<std::size_t>(draw) };
+		if (column >= m_probability.size()) {
+			column = m_probability.size() - 1;
+		}
+		return (draw - static_cast<double>(column)) < m_probability[column] ? column : m_alias[column];
+	}
+
+	/**
+	*	@brief  Returns the number of weights in the table.
+	*
+	*	@return Number of weights
+	*/
+	inline std::size_t AliasTable::size() const
+	{
+		return m_probability.size();
+	}
+
+} // namespace ga
+
+#endif	// ALIAS_TABLE_H_
@@ -0,0 +1,135 @@
+/**
+* @class AllocationCounter.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Counts heap allocations, to check that a GA can run without allocating memory
+*
+* Nothing is counted unless the global operator new is replaced. To do so,
+* define GA_COUNT_ALLOCATIONS at the top of exactly one source file (usually
+* the one containing main), before anything else is included:
+*
+*	#define GA_COUNT_ALLOCATIONS
+*	#include "AllocationCounter.h"
+*
+* runAllocationTest() in GeneticAlgorithmTechniques.h uses this counter, and
+* the AllocationTest project in the Benchmarks folder runs it after each
+* Release build.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef ALLOCATION_COUNTER_H_
+#define ALLOCATION_COUNTER_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace ga
+{
+	class AllocationCounter
+	{
+	public:
+		static void recordAllocation();
+		static unsigned long long int getCount();
+		static bool isEnabled();
+
+	private:
+		static std::atomic<unsigned long long int>& getCounter();
+	};
+
+	/**
+	*	@brief  Adds 1 to the allocation count. Called by the replaced operator new.
+	*
+	*	@return void
+	*/
+	inline void AllocationCounter::recordAllocation()
+	{
+		getCounter().fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	*	@brief  Returns the number of allocations so far.
+	*	Compare two counts to find the allocations made in between.
+	*
+	*	@return Allocation count
+	*/
+	inline unsigned long long int AllocationCounter::getCount()
+	{
+		return getCounter().load(std::memory_order_relaxed);
+	}
+
+	/**
+	*	@brief  Returns true if operator new has been replaced, by making a single allocation.
+	*	operator new is called directly, as the compiler is allowed to
+	*	remove an unused new-expression.
+	*
+	*	@return true if allocations are being counted, false otherwise
+	*/
+	inline bool AllocationCounter::isEnabled()
+	{
+		const unsigned long long int before{ getCount() };
+		void* probe{ ::operator new(1) };
+		::operator delete(probe);
+		return getCount() != before;
+	}
+
+	/**
+	*	@brief  Returns the counter shared by every source file.
+	*
+	*	@return Reference to the counter
+	*/
+	inline std::atomic<unsigned long long int>& AllocationCounter::getCounter()
+	{
+		static std::atomic<unsigned long long int> counter{ 0 };
+		return counter;
+	}
+
+} // namespace ga
+
+#ifdef GA_COUNT_ALLOCATIONS
+
+// Replacement global allocation functions
+// These must only be defined in one source file
+void* operator new(std::size_t t_size)
+{
+	ga::AllocationCounter::recordAllocation();
+	void* memory{ std::malloc(t_size > 0 ? t_size : 1) };
+	if (!memory) {
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void* operator new[](std::size_t t_size)
+{
+	return operator new(t_size);
+}
+
+void operator delete(void* t_memory) noexcept
+{
+	std::free(t_memory);
+}
+
+void operator delete[](void* t_memory) noexcept
+{
+	std::free(t_memory);
+}
+
+void operator delete(void* t_memory, std::size_t) noexcept
+{
+	std::free(t_memory);
+}
+
+void operator delete[](void* t_memory, std::size_t) noexcept
+{
+	std::free(t_memory);
+}
+
+#endif	// GA_COUNT_ALLOCATIONS
+
+#endif	// ALLOCATION_COUNTER_H_
@@ -0,0 +1,361 @@
+#include "CSVTable.h"
+
+#include <iostream>
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+
+#include "ImportData.h"
+
+namespace ga
+{
+	namespace
+	{
+		// Lines are indexed in chunks of at least this many bytes
+		const std::size_t minIndexChunkBytes{ 1 << 20 };
+		// Number of rows parsed by each thread at a time
+		const std::size_t parseChunkRows{ 4096 };
+
+		std::size_t getColumnTypeBytes(const CSVColumnType t_type)
+		{
+			switch (t_type)
+			{
+			case CSVColumnType::int32:
+			case CSVColumnType::float32:
+				return 4;
+			default:
+				return 8;
+			}
+		}
+
+		// True if a line has no characters, other than a Windows line ending
+		bool isEmptyLine(const char* t_first, const char* t_last)
+		{
+			return t_first == t_last || (t_last - t_first == 1 && *t_first == '\r');
+		}
+	}
+
+	/**
+	*	@brief  Maps a CSV file, reads its header, and finds the start of every row. No columns are parsed yet.
+	*	Any file already open, and any loaded columns, are released first.
+	*	With a thread pool, the file is split into chunks and each
+	*	thread finds the lines starting in its chunks.
+	*
+	*	@param  t_filename specifies the path and filename of the CSV file
+	*	@param  t_hasHeader specifies whether the first line holds the column names
+	*	@param  t_threadPool specifies the threads used to find the rows, or nullptr to use the calling thread
+	*	@param  t_delimiter specifies the character between values
+	*	@return true if the file was opened, false otherwise
+	*/
+	bool CSVTable::open(const std::string t_filename, const bool t_hasHeader, ThreadPool* t_threadPool, const char t_delimiter)
+	{
+		close();
+		clearColumns();
+		if (!m_file.open(t_filename)) {
+			return false;
+		}
+		m_delimiter = t_delimiter;
+
+		// Find the first line with any values
+		const char* const data{ m_file.data() };
+		const char* const fileEnd{ data + m_file.size() };
+		const char* firstLine{ data };
+		const char* firstLineEnd{ data };
+		while (firstLine != fileEnd)
+		{
+			firstLineEnd = getLineEnd(firstLine);
+			if (!isEmptyLine(firstLine, firstLineEnd)) {
+				break;
+			}
+			firstLine = firstLineEnd == fileEnd ? fileEnd : firstLineEnd + 1;
+		}
+		if (firstLine == fileEnd) {
+			std::cout << "\nERROR: File " + t_filename + " has no rows\n\n";
+			close();
+			return false;
+		}
+
+		// The column count is taken from the first line
+		bif::CSVCursor cursor(firstLine, firstLineEnd, m_delimiter);
+		bif::TokenView token;
+		while (cursor.next(token)) {
+			m_columnNames.push_back(t_hasHeader ? token.trim().toString() : std::string());
+		}
+		m_columns.resize(m_columnNames.size());
+
+		const std::size_t dataStart{ static_cast<std::size_t>((t_hasHeader ? (firstLineEnd == fileEnd ? fileEnd : firstLineEnd + 1) : firstLine) - data) };
+		indexLines(dataStart, t_threadPool);
+		return true;
+	}
+
+	/**
+	*	@brief  Unmaps the file and releases the row index. Loaded columns are kept, so close() can be called once every column is loaded.
+	*
+	*	@return void
+	*/
+	void CSVTable::close()
+	{
+		m_file.close();
+		m_rowOffsets.clear();
+		m_rowOffsets.shrink_to_fit();
+	}
+
+	/**
+	*	@brief  Returns true if a file is open, so more columns can be loaded.
+	*
+	*	@return true if a file is mapped
+	*/
+	bool CSVTable::isOpen() const
+	{
+		return m_file.isOpen();
+	}
+
+	/**
+	*	@brief  Parses a column, by name, into an aligned array of the given type.
+	*
+	*	@param  t_name specifies the column, as named in the header
+	*	@param  t_type specifies the type of the array
+	*	@param  t_threadPool specifies the threads used to parse the rows, or nullptr to use the calling thread
+	*	@return true if every value was read, false otherwise
+	*/
+	bool CSVTable::loadColumn(const std::string t_name, const CSVColumnType t_type, ThreadPool* t_threadPool)
+	{
+		const std::size_t column{ findColumn(t_name) };
+		if (column == npos) {
+			std::cout << "\nERROR: There is no column named " + t_name + "\n\n";
+			return false;
+		}
+		return loadColumn(column, t_type, t_threadPool);
+	}
+
+	/**
+	*	@brief  Parses a column, by position, into an aligned array of the given type.
+	*	Rows are parsed straight from the mapped file, without building
+	*	strings, and each thread parses a different block of rows. A
+	*	missing or unreadable value is set to 0, and the column is still
+	*	loaded. Loading a column again replaces it.
+	*
+	*	@param  t_column specifies the column, starting from 0
+	*	@param  t_type specifies the type of the array
+	*	@param  t_threadPool specifies the threads used to parse the rows, or nullptr to use the calling thread
+	*	@return true if every value was read, false otherwise
+	*/
+	bool CSVTable::loadColumn(const std::size_t t_column, const CSVColumnType t_type, ThreadPool* t_threadPool)
+	{
+		if (!isOpen()) {
+			std::cout << "\nERROR: Columns can only be loaded while the CSV file is open\n\n";
+			return false;
+		}
+		if (t_column >= getColumnCount()) {
+			std::cout << "\nERROR: Column " << t_column << " does not exist. The file has " << getColumnCount() << " columns.\n\n";
+			return false;
+		}
+
+		std::unique_ptr<Column> column{ new Column() };
+		column->type = t_type;
+		column->rawData.reset(new char[m_rowCount * getColumnTypeBytes(t_type) + alignment]);
+		const std::size_t address{ reinterpret_cast<std::size_t>(column->rawData.get()) };
+		char* data{ column->rawData.get() + (alignment - address % alignment) % alignment };
+		column->data = data;
+
+		std::size_t invalidCount{ 0 };
+		switch (t_type)
+		{
+		case CSVColumnType::int32:
+			invalidCount = parseColumn(t_column, reinterpret_cast<std::int32_t*>(data), t_threadPool);
+			break;
+		case CSVColumnType::int64:
+			invalidCount = parseColumn(t_column, reinterpret_cast<std::int64_t*>(data), t_threadPool);
+			break;
+		case CSVColumnType::float32:
+			invalidCount = parseColumn(t_column, reinterpret_cast<float*>(data), t_threadPool);
+			break;
+		case CSVColumnType::float64:
+			invalidCount = parseColumn(t_column, reinterpret_cast<double*>(data), t_threadPool);
+			break;
+		}
+		m_columns[t_column] = std::move(column);
+
+		if (invalidCount > 0) {
+			std::cout << "\nERROR: " << invalidCount << " values in column " << t_column << " could not be read, and were set to 0\n\n";
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	*	@brief  Releases every loaded column.
+	*
+	*	@return void
+	*/
+	void CSVTable::clearColumns()
+	{
+		m_columns.clear();
+		m_columnNames.clear();
+		m_rowCount = 0;
+	}
+
+	/**
+	*	@brief  Returns the number of data rows, not counting the header or empty lines.
+	*
+	*	@return m_rowCount
+	*/
+	std::size_t CSVTable::getRowCount() const
+	{
+		return m_rowCount;
+	}
+
+	/**
+	*	@brief  Returns the number of columns, counted from the first line.
+	*
+	*	@return Column count
+	*/
+	std::size_t CSVTable::getColumnCount() const
+	{
+		return m_columnNames.size();
+	}
+
+	/**
+	*	@brief  Returns the name of each column. Names are empty if the file has no header.
+	*
+	*	@return m_columnNames
+	*/
+	const std::vector<std::string>& CSVTable::getColumnNames() const
+	{
+		return m_columnNames;
+	}
+
+	/**
+	*	@brief  Returns the position of a column, by name.
+	*
+	*	@param  t_name specifies the column, as named in the header
+	*	@return Position of the column, or npos if there is no such column
+	*/
+	std::size_t CSVTable::findColumn(const std::string t_name) const
+	{
+		if (t_name.empty()) {
+			return npos;
+		}
+		const auto it = std::find(std::begin(m_columnNames), std::end(m_columnNames), t_name);
+		return it == std::end(m_columnNames) ? npos : static_cast<std::size_t>(it - std::begin(m_columnNames));
+	}
+
+	/**
+	*	@brief  Records the offset of every non-empty line from t_dataStart onwards.
+	*	The file is split into equal chunks. Each line belongs to the chunk
+	*	holding its first character, so chunks can be indexed separately,
+	*	then joined in order.
+	*
+	*	@param  t_dataStart specifies the offset of the first data row
+	*	@param  t_threadPool specifies the threads to use, or nullptr
+	*	@return void
+	*/
+	void CSVTable::indexLines(const std::size_t t_dataStart, ThreadPool* t_threadPool)
+	{
+		const char* const data{ m_file.data() };
+		const std::size_t fileSize{ m_file.size() };
+		const std::size_t dataBytes{ fileSize - t_dataStart };
+
+		std::size_t chunkCount{ t_threadPool ? t_threadPool->getThreadCount() * 4 : 1 };
+		chunkCount = std::max(std::min(chunkCount, dataBytes / minIndexChunkBytes), static_cast<std::size_t>(1));
+		std::vector<std::vector<std::size_t>> chunkOffsets(chunkCount);
+
+		auto indexChunks = [&](const std::size_t t_first, const std::size_t t_last)
+		{
+			for (std::size_t chunk{ t_first }; chunk < t_last; ++chunk)
+			{
+				const std::size_t chunkBegin{ t_dataStart + dataBytes * chunk / chunkCount };
+				const std::size_t chunkEnd{ t_dataStart + dataBytes * (chunk + 1) / chunkCount };
+				std::vector<std::size_t>& offsets{ chunkOffsets[chunk] };
+
+				// Skip the end of a line which started in the previous chunk
+				const char* position{ data + chunkBegin };
+				if (chunk > 0 && data[chunkBegin - 1] != '\n')
+				{
+					const char* lineEnd{ getLineEnd(position) };
+					position = lineEnd == data + fileSize ? lineEnd : lineEnd + 1;
+				}
+
+				while (position < data + chunkEnd)
+				{
+					const char* lineEnd{ getLineEnd(position) };
+					if (!isEmptyLine(position, lineEnd)) {
+						offsets.push_back(static_cast<std::size_t>(position - data));
+					}
+					if (lineEnd == data + fileSize) {
+						break;
+					}
+					position = lineEnd + 1;
+				}
+			}
+		};
+		if (t_threadPool && chunkCount > 1) {
+			t_threadPool->parallelFor(chunkCount, 1, indexChunks);
+		}
+		else {
+			indexChunks(static_cast<std::size_t>(0), chunkCount);
+		}
+
+		std::size_t rowCount{ 0 };
+		for (const auto& offsets : chunkOffsets) {
+			rowCount += offsets.size();
+		}
+		m_rowOffsets.clear();
+		m_rowOffsets.reserve(rowCount);
+		for (const auto& offsets : chunkOffsets) {
+			m_rowOffsets.insert(std::end(m_rowOffsets), std::begin(offsets), std::end(offsets));
+		}
+		m_rowCount = rowCount;
+	}
+
+	/**
+	*	@brief  Returns the end of the line starting at t_line.
+	*
+	*	@param  t_line points to the first character of a line in the mapped file
+	*	@return Pointer to the line's '\n', or to the end of the file
+	*/
+	const char* CSVTable::getLineEnd(const char* t_line) const
+	{
+		const char* const fileEnd{ m_file.data() + m_file.size() };
+		const void* lineEnd{ std::memchr(t_line, '\n', static_cast<std::size_t>(fileEnd - t_line)) };
+		return lineEnd ? static_cast<const char*>(lineEnd) : fileEnd;
+	}
+
+	/**
+	*	@brief  Parses one value from every row into an array.
+	*
+	*	@param  t_column specifies the column
+	*	@param  t_values is filled with one value per row
+	*	@param  t_threadPool specifies the threads to use, or nullptr
+	*	@return Number of values that could not be read
+	*/
+	template <typename T>
+	std::size_t CSVTable::parseColumn(const std::size_t t_column, T* t_values, ThreadPool* t_threadPool) const
+	{
+		const char* const data{ m_file.data() };
+		std::atomic<std::size_t> invalidCount{ 0 };
+
+		auto parseRows = [&](const std::size_t t_first, const std::size_t t_last)
+		{
+			std::size_t invalid{ 0 };
+			for (std::size_t row{ t_first }; row < t_last; ++row)
+			{
+				const char* line{ data + m_rowOffsets[row] };
+				bif::CSVCursor cursor(line, getLineEnd(line), m_delimiter);
+				cursor.skip(t_column);
+				if (!cursor.read(t_values[row])) {
+					++invalid;
+				}
+			}
+			invalidCount += invalid;
+		};
+		if (t_threadPool) {
+			t_threadPool->parallelFor(m_rowCount, parseChunkRows, parseRows);
+		}
+		else {
+			parseRows(static_cast<std::size_t>(0), m_rowCount);
+		}
+		return invalidCount;
+	}
+
+} // namespace ga
@@ -0,0 +1,146 @@
+/**
+* @class CSVTable.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a loader for large CSV files of problem data, which parses columns into typed arrays
+*
+* bif::Import::csvToVector() keeps every value as a std::string, which
+* needs many times the file's size in memory. CSVTable maps the file
+* instead (see MappedFile.h), finds the start of every line on several
+* threads, and parses only the columns asked for, each into one aligned
+* array of ints or floats (structure of arrays):
+*
+*	ga::CSVTable items;
+*	items.open("items.csv", true, threadPool);
+*	items.loadColumn("weight", ga::CSVColumnType::int32, threadPool);
+*	const std::int32_t* weights{ items.getColumn<std::int32_t>("weight") };
+*
+* Once loaded, a table is only read, so every fitness thread can share
+* one copy. Several processes loading the same file share its pages in
+* the operating system's page cache.
+*
+* Values are separated by a single character. Quoted values are not
+* supported. Empty lines are skipped, and Windows line endings are allowed.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef CSV_TABLE_H_
+#define CSV_TABLE_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+#include "MappedFile.h"
+#include "ThreadPool.h"
+
+namespace ga
+{
+	enum class CSVColumnType { int32, int64, float32, float64 };
+
+	// The CSVColumnType of each array type
+	template <typename T>
+	struct CSVColumnTypeOf;
+	template <>
+	struct CSVColumnTypeOf<std::int32_t> { static const CSVColumnType value{ CSVColumnType::int32 }; };
+	template <>
+	struct CSVColumnTypeOf<std::int64_t> { static const CSVColumnType value{ CSVColumnType::int64 }; };
+	template <>
+	struct CSVColumnTypeOf<float> { static const CSVColumnType value{ CSVColumnType::float32 }; };
+	template <>
+	struct CSVColumnTypeOf<double> { static const CSVColumnType value{ CSVColumnType::float64 }; };
+
+	class CSVTable
+	{
+	public:
+		CSVTable() {};
+		~CSVTable() {};
+
+		CSVTable(const CSVTable&) = delete;
+		CSVTable& operator=(const CSVTable&) = delete;
+
+		// Returned by findColumn() when there is no such column
+		static const std::size_t npos{ static_cast<std::size_t>(-1) };
+		// Alignment of every column array
+		static const std::size_t alignment{ 64 };
+
+		bool open(const std::string, const bool = true, ThreadPool* = nullptr, const char = ',');
+		void close();
+		bool isOpen() const;
+
+		bool loadColumn(const std::string, const CSVColumnType, ThreadPool* = nullptr);
+		bool loadColumn(const std::size_t, const CSVColumnType, ThreadPool* = nullptr);
+		void clearColumns();
+
+		std::size_t getRowCount() const;
+		std::size_t getColumnCount() const;
+		const std::vector<std::string>& getColumnNames() const;
+		std::size_t findColumn(const std::string) const;
+
+		template <typename T>
+		const T* getColumn(const std::string) const;
+		template <typename T>
+		const T* getColumn(const std::size_t) const;
+
+	private:
+		struct Column
+		{
+			CSVColumnType type;
+			// Raw allocation, and the same memory rounded up to the alignment
+			std::unique_ptr<char[]> rawData;
+			const char* data{ nullptr };
+		};
+
+		void indexLines(const std::size_t, ThreadPool*);
+		const char* getLineEnd(const char*) const;
+
+		template <typename T>
+		std::size_t parseColumn(const std::size_t, T*, ThreadPool*) const;
+
+		MappedFile m_file;
+		char m_delimiter{ ',' };
+		// Offset of the first character of each data row
+		std::vector<std::size_t> m_rowOffsets;
+		std::size_t m_rowCount{ 0 };
+		std::vector<std::string> m_columnNames;
+		// One entry per column, empty until the column is loaded
+		std::vector<std::unique_ptr<Column>> m_columns;
+	};
+
+	/**
+	*	@brief  Returns a loaded column, by name.
+	*
+	*	@param  t_name specifies the column
+	*	@return Pointer to getRowCount() values, or nullptr if the column was not loaded as type T
+	*/
+	template <typename T>
+	const T* CSVTable::getColumn(const std::string t_name) const
+	{
+		return getColumn<T>(findColumn(t_name));
+	}
+
+	/**
+	*	@brief  Returns a loaded column, by position.
+	*
+	*	@param  t_column specifies the column
+	*	@return Pointer to getRowCount() values, or nullptr if the column was not loaded as type T
+	*/
+	template <typename T>
+	const T* CSVTable::getColumn(const std::size_t t_column) const
+	{
+		if (t_column >= m_columns.size() || !m_columns[t_column] || m_columns[t_column]->type != CSVColumnTypeOf<T>::value) {
+			return nullptr;
+		}
+		return reinterpret_cast<const T*>(m_columns[t_column]->data);
+	}
+
+} // namespace ga
+
+#endif	// CSV_TABLE_H_
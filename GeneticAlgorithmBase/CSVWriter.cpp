@@ -0,0 +1,178 @@
+#include "CSVWriter.h"
+
+#include <iostream>
+
+namespace ga
+{
+	/**
+	*	@brief  Writes anything left in the buffer, then closes the file.
+	*/
+	CSVWriter::~CSVWriter()
+	{
+		close();
+	}
+
+	/**
+	*	@brief  Opens a file to write rows to. Any file already open is closed first.
+	*	The file is written in binary mode, so lines end with '\n' on every
+	*	platform, which CSVCursor and CSVTable both read.
+	*
+	*	@param  t_filename specifies the path and filename of the file
+	*	@param  t_isAppending specifies whether to add to the end of an existing file, rather than replace it
+	*	@return true if the file was opened, false otherwise
+	*/
+	bool CSVWriter::open(const std::string t_filename, const bool t_isAppending)
+	{
+		close();
+
+		m_oStream.open(t_filename, std::ios::out | std::ios::binary | (t_isAppending ? std::ios::app : std::ios::trunc));
+		if (!m_oStream.is_open()) {
+			std::cout << "\nERROR: Unable to open file " + t_filename + "\n\n";
+			return false;
+		}
+
+		m_filename = t_filename;
+		m_buffer.clear();
+		m_bytesWritten = 0;
+		m_hasFailed = false;
+		m_isNewFile = true;
+		if (t_isAppending)
+		{
+			m_oStream.seekp(0, std::ios::end);
+			m_isNewFile = (m_oStream.tellp() <= 0);
+		}
+		return true;
+	}
+
+	/**
+	*	@brief  Writes anything left in the buffer, then closes the file.
+	*
+	*	@return true if every row was written, false otherwise
+	*/
+	bool CSVWriter::close()
+	{
+		if (!m_oStream.is_open()) {
+			return !m_hasFailed;
+		}
+		flush();
+		m_oStream.close();
+		return !m_hasFailed;
+	}
+
+	bool CSVWriter::isOpen() const
+	{
+		return m_oStream.is_open();
+	}
+
+	/**
+	*	@brief  Returns true if the file held nothing when it was opened, so a header row is needed.
+	*
+	*	@return m_isNewFile
+	*/
+	bool CSVWriter::isNewFile() const
+	{
+		return m_isNewFile;
+	}
+
+	/**
+	*	@brief  Writes the buffer to the file, and flushes the file stream.
+	*
+	*	@return true if the buffer was written, false otherwise
+	*/
+	bool CSVWriter::flush()
+	{
+		const bool isWritten{ writeBuffer(m_buffer) };
+		if (m_oStream.is_open()) {
+			m_oStream.flush();
+		}
+		return isWritten && !m_oStream.fail();
+	}
+
+	/**
+	*	@brief  Returns the buffer to write the current row to.
+	*
+	*	@return m_buffer
+	*/
+	bif::CSVBuffer& CSVWriter::getBuffer()
+	{
+		return m_buffer;
+	}
+
+	/**
+	*	@brief  Ends the current row. The buffer is written to the file once it reaches the buffer size.
+	*
+	*	@return void
+	*/
+	void CSVWriter::endLine()
+	{
+		m_buffer.endLine();
+		if (m_buffer.size() >= m_bufferSize) {
+			writeBuffer(m_buffer);
+		}
+	}
+
+	/**
+	*	@brief  Sets m_bufferSize, the characters kept in memory before they are written to the file.
+	*
+	*	@param  t_bufferSize specifies the size in characters (0 writes every row as it ends)
+	*	@return void
+	*/
+	void CSVWriter::setBufferSize(const std::size_t t_bufferSize)
+	{
+		m_bufferSize = t_bufferSize;
+		if (m_buffer.size() >= m_bufferSize) {
+			writeBuffer(m_buffer);
+		}
+	}
+
+	std::size_t CSVWriter::getBufferSize() const
+	{
+		return m_bufferSize;
+	}
+
+	unsigned long long int CSVWriter::getBytesWritten() const
+	{
+		return m_bytesWritten;
+	}
+
+	/**
+	*	@brief  Returns true if anything could not be written since the file was opened.
+	*
+	*	@return m_hasFailed
+	*/
+	bool CSVWriter::hasFailed() const
+	{
+		return m_hasFailed;
+	}
+
+	/**
+	*	@brief  Writes a buffer to the file in one call, then empties it.
+	*	Only the first failure is reported.
+	*
+	*	@param  t_buffer specifies the buffer to write
+	*	@return true if the buffer was written, false otherwise
+	*/
+	bool CSVWriter::writeBuffer(bif::CSVBuffer& t_buffer)
+	{
+		if (t_buffer.empty()) {
+			return true;
+		}
+		bool isWritten{ false };
+		if (m_oStream.is_open())
+		{
+			m_oStream.write(t_buffer.data(), static_cast<std::streamsize>(t_buffer.size()));
+			isWritten = !m_oStream.fail();
+		}
+		if (isWritten) {
+			m_bytesWritten += t_buffer.size();
+		}
+		else if (!m_hasFailed)
+		{
+			m_hasFailed = true;
+			std::cout << "\nERROR: Unable to write to file " + m_filename + "\n\n";
+		}
+		t_buffer.clear();
+		return isWritten;
+	}
+
+} // namespace ga
@@ -0,0 +1,156 @@
+/**
+* @class CSVWriter.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a buffered CSV file writer, which can format rows on several threads
+*
+* Rows are built in a bif::CSVBuffer (see ImportData.h) rather than
+* through ostream <<, and reach the file in large blocks. A writer keeps
+* its file open, so a row can be added every generation without reopening
+* the file:
+*
+*	ga::CSVWriter history;
+*	history.open("history.csv", true);	// Append to any earlier run
+*	history.getBuffer().write(generation);
+*	history.getBuffer().write(bestScore);
+*	history.endLine();
+*
+* writeRows() formats many rows at once. With a thread pool, blocks of
+* rows are formatted on every thread, then written in order.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef CSV_WRITER_H_
+#define CSV_WRITER_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+#include "ImportData.h"
+#include "ThreadPool.h"
+
+namespace ga
+{
+	class CSVWriter
+	{
+	public:
+		explicit CSVWriter(const char t_delimiter = ',')
+			: m_buffer(t_delimiter)
+		{ };
+		~CSVWriter();
+
+		CSVWriter(const CSVWriter&) = delete;
+		CSVWriter& operator=(const CSVWriter&) = delete;
+
+		// Size the buffer may reach before it is written to the file
+		static const std::size_t defaultBufferSize{ 1 << 20 };
+
+		bool open(const std::string, const bool = false);
+		bool close();
+		bool isOpen() const;
+		bool isNewFile() const;
+		bool flush();
+
+		// Rows are added to the buffer, and each row is ended with endLine()
+		bif::CSVBuffer& getBuffer();
+		void endLine();
+		template <typename F>
+		void writeRows(const std::size_t, F&, ThreadPool* = nullptr, const std::size_t = 64);
+
+		void setBufferSize(const std::size_t);
+		std::size_t getBufferSize() const;
+		unsigned long long int getBytesWritten() const;
+		bool hasFailed() const;
+
+	private:
+		bool writeBuffer(bif::CSVBuffer&);
+
+		std::ofstream m_oStream;
+		std::string m_filename;
+		bif::CSVBuffer m_buffer;
+		// Buffers for blocks of rows formatted on other threads (reused)
+		std::vector<bif::CSVBuffer> m_blockBuffers;
+		std::size_t m_bufferSize{ defaultBufferSize };
+		unsigned long long int m_bytesWritten{ 0 };
+		// True if the file held nothing when it was opened
+		bool m_isNewFile{ true };
+		bool m_hasFailed{ false };
+	};
+
+	/**
+	*	@brief  Formats rows and adds them to the file, in order.
+	*	t_formatRow(row, buffer) is called for each row in [0, t_count), and
+	*	writes the row's values to buffer (without ending the line). With a
+	*	thread pool, blocks of rows are formatted on every thread, so
+	*	t_formatRow must be safe to call for different rows at once.
+	*	A few blocks per thread are formatted at a time, so memory use
+	*	does not grow with the number of rows.
+	*
+	*	@param  t_count specifies the number of rows
+	*	@param  t_formatRow is called as t_formatRow(row, buffer) for each row
+	*	@param  t_threadPool specifies the threads to format on (nullptr formats on this thread)
+	*	@param  t_blockSize specifies the number of rows handed to a thread at a time
+	*	@return void
+	*/
+	template <typename F>
+	void CSVWriter::writeRows(const std::size_t t_count, F& t_formatRow, ThreadPool* t_threadPool, const std::size_t t_blockSize)
+	{
+		const std::size_t blockSize{ std::max(t_blockSize, static_cast<std::size_t>(1)) };
+		if (t_threadPool == nullptr || t_threadPool->getThreadCount() < 2 || t_count <= blockSize)
+		{
+			for (std::size_t row{ 0 }; row < t_count; ++row)
+			{
+				t_formatRow(row, m_buffer);
+				endLine();
+			}
+			return;
+		}
+
+		// Rows already in the buffer come first
+		writeBuffer(m_buffer);
+
+		const std::size_t roundBlocks{ t_threadPool->getThreadCount() * 4 };
+		if (m_blockBuffers.size() < roundBlocks) {
+			m_blockBuffers.resize(roundBlocks, bif::CSVBuffer(m_buffer.getDelimiter()));
+		}
+
+		for (std::size_t roundFirst{ 0 }; roundFirst < t_count; roundFirst += roundBlocks * blockSize)
+		{
+			const std::size_t roundCount{ std::min(roundBlocks * blockSize, t_count - roundFirst) };
+			const std::size_t blockCount{ (roundCount + blockSize - 1) / blockSize };
+
+			auto formatBlocks = [&](const std::size_t t_firstBlock, const std::size_t t_lastBlock)
+			{
+				for (std::size_t block{ t_firstBlock }; block < t_lastBlock; ++block)
+				{
+					bif::CSVBuffer& buffer{ m_blockBuffers[block] };
+					buffer.clear();
+					const std::size_t firstRow{ roundFirst + block * blockSize };
+					const std::size_t lastRow{ std::min(firstRow + blockSize, t_count) };
+					for (std::size_t row{ firstRow }; row < lastRow; ++row)
+					{
+						t_formatRow(row, buffer);
+						buffer.endLine();
+					}
+				}
+			};
+			t_threadPool->parallelFor(blockCount, 1, formatBlocks);
+
+			for (std::size_t block{ 0 }; block < blockCount; ++block) {
+				writeBuffer(m_blockBuffers[block]);
+			}
+		}
+	}
+
+} // namespace ga
+
+#endif	// CSV_WRITER_H_
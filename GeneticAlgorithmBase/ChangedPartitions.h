@@ -0,0 +1,343 @@
+/**
+* @class ChangedPartitions.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a record of which encoded partitions of a Chromo have changed since it was last scored
+*
+* Mutations and crossovers usually change only a few partitions. A Chromo
+* with change tracking keeps one bit per partition, set when an operator
+* changes that partition, along with the bytes the partition held before
+* its first change. A fitness function that is a sum over partitions (or
+* over items, as in a knapsack) can then update the previous score from
+* the changed partitions alone (see Chromo::updateFitness()):
+*
+*	for (std::size_t p{ t_changed.findNext(0) }; p != ChangedPartitions::npos; p = t_changed.findNext(p + 1)) {
+*		const EncodedPartition& partition{ t_changed.getPartition(p) };
+*		// Subtract what t_changed.getPreviousData() + partition.location added to the score,
+*		// then add what the current data adds
+*	}
+*
+* When a change cannot be tied to partitions (such as reading a file, or
+* mutateCustom()), every partition is marked as changed, and the fitness
+* function is run in full.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef CHANGED_PARTITIONS_H_
+#define CHANGED_PARTITIONS_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "GeneticAlgorithmTechniques.h"
+
+namespace ga
+{
+	class ChangedPartitions
+	{
+	public:
+		ChangedPartitions() {};
+
+		// Returned by findNext() when no more partitions have changed
+		static const std::size_t npos{ static_cast<std::size_t>(-1) };
+
+		void enable(const std::vector<EncodedPartition>&);
+		bool isEnabled() const;
+
+		void clear();
+		void markAll();
+		void markBytes(const std::size_t, const std::size_t, const char*, const std::size_t);
+		void markDifferences(const char*, const char*, const std::size_t);
+
+		bool isAllChanged() const;
+		bool isEmpty() const;
+		bool isChanged(const std::size_t) const;
+		std::size_t findNext(const std::size_t) const;
+		std::size_t getPartitionCount() const;
+		const EncodedPartition& getPartition(const std::size_t) const;
+		const char* getPreviousData() const;
+
+	private:
+		std::size_t findPartition(const std::size_t, const std::size_t) const;
+		void markPartition(const std::size_t, const char*);
+
+		// Partitions of the Chromo class, owned by the GeneticAlgorithm
+		const std::vector<EncodedPartition>* m_partitions{ nullptr };
+		// One bit per partition
+		std::vector<std::uint64_t> m_words;
+		// The data before any change, valid within changed partitions only
+		std::vector<char> m_previousData;
+		bool m_isAllChanged{ true };
+		bool m_isEmpty{ false };
+	};
+
+	/**
+	*	@brief  Starts tracking changes. Until the next call to clear(), every partition is treated as changed.
+	*
+	*	@param  t_partitions specifies the partitions of the encoded data, which must outlive this object
+	*	@return void
+	*/
+	inline void ChangedPartitions::enable(const std::vector<EncodedPartition>& t_partitions)
+	{
+		m_partitions = &t_partitions;
+		m_words.assign((t_partitions.size() + 63) / 64, 0);
+		markAll();
+	}
+
+	inline bool ChangedPartitions::isEnabled() const
+	{
+		return m_partitions != nullptr;
+	}
+
+	/**
+	*	@brief  Marks every partition as unchanged, such as once the Chromo has been scored.
+	*	Does nothing until enable() is called, so untracked Chromos always count as fully changed.
+	*
+	*	@return void
+	*/
+	inline void ChangedPartitions::clear()
+	{
+		if (m_partitions == nullptr) {
+			return;
+		}
+		if (!m_isEmpty) {
+			std::fill(m_words.begin(), m_words.end(), 0);
+		}
+		m_isAllChanged = false;
+		m_isEmpty = true;
+	}
+
+	/**
+	*	@brief  Marks every partition as changed, so the fitness function must be run in full.
+	*
+	*	@return void
+	*/
+	inline void ChangedPartitions::markAll()
+	{
+		m_isAllChanged = true;
+		m_isEmpty = false;
+	}
+
+	/**
+	*	@brief  Marks the partitions holding a range of bytes, before the bytes are changed.
+	*	Bytes outside every partition mark everything as changed.
+	*
+	*	@param  t_firstByte specifies the first byte to be changed
+	*	@param  t_endByte specifies the byte after the last one to be changed
+	*	@param  t_data points to the encoded data, before the change
+	*	@param  t_length specifies the length of the encoded data
+	*	@return void
+	*/
+	inline void ChangedPartitions::markBytes(const std::size_t t_firstByte, const std::size_t t_endByte, const char* t_data, const std::size_t t_length)
+	{
+		if (m_isAllChanged || t_firstByte >= t_endByte) {
+			return;
+		}
+		m_previousData.resize(t_length);
+
+		std::size_t partitionId{ 0 };
+		for (std::size_t byte{ t_firstByte }; byte < t_endByte && !m_isAllChanged;)
+		{
+			partitionId = findPartition(byte, partitionId);
+			if (partitionId == npos) {
+				markAll();
+				return;
+			}
+			markPartition(partitionId, t_data);
+			const EncodedPartition& partition{ (*m_partitions)[partitionId] };
+			byte = partition.location + partition.bytes;
+		}
+	}
+
+	/**
+	*	@brief  Marks every partition where new data differs from the data it replaces.
+	*	Data is compared 8 bytes at a time, and each changed partition is only
+	*	compared once, so this costs about as much as copying the data.
+	*
+	*	@param  t_previousData points to the data before the change
+	*	@param  t_data points to the data after the change
+	*	@param  t_length specifies the length of both
+	*	@return void
+	*/
+	inline void ChangedPartitions::markDifferences(const char* t_previousData, const char* t_data, const std::size_t t_length)
+	{
+		if (m_isAllChanged) {
+			return;
+		}
+		m_previousData.resize(t_length);
+
+		std::size_t partitionId{ 0 };
+		std::size_t byte{ 0 };
+		while (byte < t_length && !m_isAllChanged)
+		{
+			// Skip equal words
+			for (; byte + 8 <= t_length; byte += 8)
+			{
+				std::uint64_t previousWord, word;
+				std::memcpy(&previousWord, t_previousData + byte, 8);
+				std::memcpy(&word, t_data + byte, 8);
+				if (previousWord != word) {
+					break;
+				}
+			}
+			// Find the first different byte
+			while (byte < t_length && t_previousData[byte] == t_data[byte]) {
+				++byte;
+			}
+			if (byte == t_length) {
+				return;
+			}
+
+			partitionId = findPartition(byte, partitionId);
+			if (partitionId == npos) {
+				markAll();
+				return;
+			}
+			markPartition(partitionId, t_previousData);
+			const EncodedPartition& partition{ (*m_partitions)[partitionId] };
+			byte = partition.location + partition.bytes;
+		}
+	}
+
+	/**
+	*	@brief  Returns true if every partition must be treated as changed.
+	*
+	*	@return m_isAllChanged
+	*/
+	inline bool ChangedPartitions::isAllChanged() const
+	{
+		return m_isAllChanged;
+	}
+
+	/**
+	*	@brief  Returns true if no partition has changed.
+	*
+	*	@return m_isEmpty
+	*/
+	inline bool ChangedPartitions::isEmpty() const
+	{
+		return m_isEmpty;
+	}
+
+	inline bool ChangedPartitions::isChanged(const std::size_t t_partitionId) const
+	{
+		if (m_isAllChanged) {
+			return true;
+		}
+		return t_partitionId / 64 < m_words.size() && ((m_words[t_partitionId / 64] >> (t_partitionId % 64)) & 1) != 0;
+	}
+
+	/**
+	*	@brief  Finds the next changed partition, skipping 64 unchanged partitions at a time.
+	*	Only meaningful when isAllChanged() is false.
+	*
+	*	@param  t_partitionId specifies the first partition to check
+	*	@return ID of the next changed partition, or npos if there are none
+	*/
+	inline std::size_t ChangedPartitions::findNext(const std::size_t t_partitionId) const
+	{
+		std::size_t wordId{ t_partitionId / 64 };
+		if (m_isEmpty || wordId >= m_words.size()) {
+			return npos;
+		}
+		std::uint64_t word{ m_words[wordId] & (~0ULL << (t_partitionId % 64)) };
+		while (word == 0)
+		{
+			if (++wordId == m_words.size()) {
+				return npos;
+			}
+			word = m_words[wordId];
+		}
+		std::size_t bit{ 0 };
+		while (((word >> bit) & 1) == 0) {
+			++bit;
+		}
+		return wordId * 64 + bit;
+	}
+
+	inline std::size_t ChangedPartitions::getPartitionCount() const
+	{
+		return m_partitions ? m_partitions->size() : 0;
+	}
+
+	inline const EncodedPartition& ChangedPartitions::getPartition(const std::size_t t_partitionId) const
+	{
+		return (*m_partitions)[t_partitionId];
+	}
+
+	/**
+	*	@brief  Returns the encoded data from before the changes, at the same offsets as the current data.
+	*	Only the bytes of changed partitions are kept.
+	*
+	*	@return Pointer to the previous data
+	*/
+	inline const char* ChangedPartitions::getPreviousData() const
+	{
+		return m_previousData.data();
+	}
+
+	/**
+	*	@brief  Finds the partition holding a byte. Partitions are in order, so the search starts from a hint.
+	*
+	*	@param  t_byte specifies the byte
+	*	@param  t_hint specifies a partition at or before the one holding the byte
+	*	@return ID of the partition, or npos if no partition holds the byte
+	*/
+	inline std::size_t ChangedPartitions::findPartition(const std::size_t t_byte, const std::size_t t_hint) const
+	{
+		const std::vector<EncodedPartition>& partitions{ *m_partitions };
+		// Binary search for the last partition starting at or before the byte
+		std::size_t low{ std::min(t_hint, partitions.size()) };
+		std::size_t high{ partitions.size() };
+		while (low < high)
+		{
+			const std::size_t middle{ low + (high - low) / 2 };
+			if (partitions[middle].location <= t_byte) {
+				low = middle + 1;
+			}
+			else {
+				high = middle;
+			}
+		}
+		if (low == 0 || t_byte >= partitions[low - 1].location + partitions[low - 1].bytes) {
+			return npos;
+		}
+		return low - 1;
+	}
+
+	/**
+	*	@brief  Marks a partition, keeping its previous bytes the first time it changes.
+	*
+	*	@param  t_partitionId specifies the partition
+	*	@param  t_previousData points to the data before the change
+	*	@return void
+	*/
+	inline void ChangedPartitions::markPartition(const std::size_t t_partitionId, const char* t_previousData)
+	{
+		const EncodedPartition& partition{ (*m_partitions)[t_partitionId] };
+		if (partition.location + partition.bytes > m_previousData.size()) {
+			// The data is shorter than its partitions
+			markAll();
+			return;
+		}
+
+		std::uint64_t& word{ m_words[t_partitionId / 64] };
+		const std::uint64_t bit{ 1ULL << (t_partitionId % 64) };
+		if ((word & bit) == 0)
+		{
+			word |= bit;
+			std::memcpy(m_previousData.data() + partition.location, t_previousData + partition.location, partition.bytes);
+		}
+		m_isEmpty = false;
+	}
+
+} // namespace ga
+
+#endif	// CHANGED_PARTITIONS_H_
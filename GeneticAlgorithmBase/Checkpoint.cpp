@@ -0,0 +1,348 @@
+#include "Checkpoint.h"
+
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstddef>
+#include <cstdio>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif	// NOMINMAX
+#include <windows.h>
+#endif	// _WIN32
+
+#include "ChromoSerialization.h"
+#include "PopulationBuffer.h"
+
+namespace ga
+{
+	namespace
+	{
+		const char checkpointMagic[8]{ 'G', 'A', 'B', 'C', 'K', 'P', 'T', '\0' };
+
+		// Number of slots hashed by each thread at a time
+		const std::size_t hashChunkSize{ 1024 };
+
+		std::uint64_t roundUpToAlignment(const std::uint64_t t_bytes)
+		{
+			return (t_bytes + checkpointAlignment - 1) / checkpointAlignment * checkpointAlignment;
+		}
+
+		void appendHashValue(std::string& t_bytes, const std::uint64_t t_value)
+		{
+			t_bytes.append(reinterpret_cast<const char*>(&t_value), sizeof(t_value));
+		}
+
+		// Replaces t_target with t_source, even if t_target exists
+		bool replaceFile(const std::string& t_source, const std::string& t_target)
+		{
+#ifdef _WIN32
+			return MoveFileExA(t_source.c_str(), t_target.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+			return std::rename(t_source.c_str(), t_target.c_str()) == 0;
+#endif	// _WIN32
+		}
+	}
+
+	/**
+	*	@brief  Returns the memory held by a snapshot's encodings and scores.
+	*
+	*	@return Number of bytes
+	*/
+	std::size_t CheckpointSnapshot::getBytes() const
+	{
+		return encodings.capacity() + scores.capacity() * sizeof(double);
+	}
+
+	/**
+	*	@brief  Clears a header, then fills in its identity and layout.
+	*	Slots use the same stride as PopulationBuffer. The caller fills
+	*	in the schema, random state, settings, and checksums.
+	*
+	*	@param  t_header specifies the header to fill
+	*	@param  t_chromoCount specifies the number of Chromos
+	*	@param  t_encodedBytes specifies the number of encoded bytes per Chromo
+	*	@return void
+	*/
+	void initializeCheckpointHeader(CheckpointHeader& t_header, const std::size_t t_chromoCount, const std::size_t t_encodedBytes)
+	{
+		std::memset(&t_header, 0, sizeof(CheckpointHeader));
+		std::memcpy(t_header.magic, checkpointMagic, sizeof(checkpointMagic));
+		t_header.version = checkpointVersion;
+		t_header.headerBytes = static_cast<std::uint32_t>(sizeof(CheckpointHeader));
+
+		t_header.chromoCount = t_chromoCount;
+		t_header.encodedBytes = t_encodedBytes;
+		t_header.stride = PopulationBuffer::calculateStride(t_encodedBytes);
+		t_header.encodingsOffset = roundUpToAlignment(sizeof(CheckpointHeader));
+		t_header.scoresOffset = roundUpToAlignment(t_header.encodingsOffset + t_header.chromoCount * t_header.stride);
+		t_header.fileBytes = t_header.scoresOffset + t_header.chromoCount * sizeof(double);
+	}
+
+	/**
+	*	@brief  Returns a hash of every byte of a header before its own checksum.
+	*
+	*	@param  t_header specifies the header
+	*	@return 64-bit hash
+	*/
+	std::uint64_t hashCheckpointHeader(const CheckpointHeader& t_header)
+	{
+		return hashEncodedData(reinterpret_cast<const char*>(&t_header), offsetof(CheckpointHeader, headerChecksum));
+	}
+
+	/**
+	*	@brief  Returns a hash of the layout of a Chromo's encoded data.
+	*	Two Chromo classes only share a hash if their partitions have
+	*	the same names, locations, sizes, and types.
+	*
+	*	@param  t_encodedPartitions specifies the partitions
+	*	@param  t_mutationLimits specifies the bytes and partitions allowed for mutations
+	*	@return 64-bit hash
+	*/
+	std::uint64_t hashEncodedPartitions(const std::vector<EncodedPartition>& t_encodedPartitions, const MutationLimits t_mutationLimits)
+	{
+		std::string bytes;
+		appendHashValue(bytes, t_mutationLimits.bytes);
+		appendHashValue(bytes, t_mutationLimits.partitions);
+		for (const EncodedPartition& partition : t_encodedPartitions)
+		{
+			bytes += partition.name;
+			bytes += '\0';
+			appendHashValue(bytes, partition.location);
+			appendHashValue(bytes, partition.bytes);
+			appendHashValue(bytes, static_cast<std::uint64_t>(partition.type));
+			appendHashValue(bytes, partition.type == EncodedPartitionType::eachBitUnique ? partition.uniqueBits : 0);
+		}
+		return hashEncodedData(bytes.data(), bytes.length());
+	}
+
+	/**
+	*	@brief  Returns the data checksum of a checkpoint, from the hash of each slot and the scores.
+	*	Each slot is hashed separately (including its padding), so slots
+	*	can be hashed in parallel, or one at a time as they are written.
+	*
+	*	@param  t_slotHashes specifies the hash of each slot
+	*	@param  t_scores points to the first score
+	*	@param  t_chromoCount specifies the number of scores
+	*	@return 64-bit checksum
+	*/
+	std::uint64_t combineCheckpointHashes(const std::vector<std::uint64_t>& t_slotHashes, const double* t_scores, const std::size_t t_chromoCount)
+	{
+		const std::uint64_t hashes[2]{
+			hashEncodedData(reinterpret_cast<const char*>(t_slotHashes.data()), t_slotHashes.size() * sizeof(std::uint64_t)),
+			hashEncodedData(reinterpret_cast<const char*>(t_scores), t_chromoCount * sizeof(double))
+		};
+		return hashEncodedData(reinterpret_cast<const char*>(hashes), sizeof(hashes));
+	}
+
+	/**
+	*	@brief  Fills in a snapshot's checksums, then writes it as a checkpoint.
+	*	The checkpoint is written to t_filename + ".tmp", which then
+	*	replaces t_filename. If writing fails, any earlier checkpoint
+	*	is left as it was.
+	*
+	*	@param  t_snapshot specifies the snapshot. Its header must be filled in, apart from the checksums.
+	*	@param  t_filename specifies the path and filename of the checkpoint
+	*	@param  t_slotHashes is used to hash each slot (kept by the caller to avoid reallocating)
+	*	@return true if the checkpoint was written, false otherwise
+	*/
+	bool writeCheckpointFile(CheckpointSnapshot& t_snapshot, const std::string t_filename, std::vector<std::uint64_t>& t_slotHashes)
+	{
+		CheckpointHeader& header{ t_snapshot.header };
+		const std::size_t chromoCount{ static_cast<std::size_t>(header.chromoCount) };
+		const std::size_t stride{ static_cast<std::size_t>(header.stride) };
+
+		t_slotHashes.resize(chromoCount);
+		for (std::size_t i{ 0 }; i < chromoCount; ++i) {
+			t_slotHashes[i] = hashEncodedData(t_snapshot.encodings.data() + i * stride, stride);
+		}
+		header.dataChecksum = combineCheckpointHashes(t_slotHashes, t_snapshot.scores.data(), chromoCount);
+		header.headerChecksum = hashCheckpointHeader(header);
+
+		const std::string tempFilename{ t_filename + ".tmp" };
+		std::ofstream oStream(tempFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!oStream.is_open()) {
+			std::cout << "\nERROR: Unable to open file " + tempFilename + "\n\n";
+			return false;
+		}
+
+		const char padding[checkpointAlignment]{};
+		const std::size_t encodingsBytes{ chromoCount * stride };
+		oStream.write(reinterpret_cast<const char*>(&header), sizeof(CheckpointHeader));
+		oStream.write(padding, static_cast<std::streamsize>(header.encodingsOffset - sizeof(CheckpointHeader)));
+		oStream.write(t_snapshot.encodings.data(), static_cast<std::streamsize>(encodingsBytes));
+		oStream.write(padding, static_cast<std::streamsize>(header.scoresOffset - header.encodingsOffset - encodingsBytes));
+		oStream.write(reinterpret_cast<const char*>(t_snapshot.scores.data()), static_cast<std::streamsize>(chromoCount * sizeof(double)));
+		oStream.close();
+
+		if (oStream.fail()) {
+			std::remove(tempFilename.c_str());
+			std::cout << "\nERROR: Unable to write checkpoint " + tempFilename + "\n\n";
+			return false;
+		}
+		if (!replaceFile(tempFilename, t_filename)) {
+			std::remove(tempFilename.c_str());
+			std::cout << "\nERROR: Unable to replace checkpoint " + t_filename + "\n\n";
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	*	@brief  Maps a checkpoint into memory and checks its header. Any checkpoint already open is closed first.
+	*	Checking the data reads the whole file once. With a thread pool,
+	*	the data is checked on every thread. Skip the check to read
+	*	only the pages that are used.
+	*
+	*	@param  t_filename specifies the path and filename of the checkpoint
+	*	@param  t_isDataChecked specifies whether to check the data against its checksum
+	*	@param  t_threadPool specifies the threads used to check the data, or nullptr to check on the calling thread
+	*	@return true if the checkpoint is valid, false otherwise
+	*/
+	bool CheckpointReader::open(const std::string t_filename, const bool t_isDataChecked, ThreadPool* t_threadPool)
+	{
+		close();
+		if (!m_file.open(t_filename)) {
+			return false;
+		}
+
+		if (m_file.size() < sizeof(CheckpointHeader)) {
+			std::cout << "\nERROR: " + t_filename + " is too small to be a checkpoint.\n\n";
+			close();
+			return false;
+		}
+		std::memcpy(&m_header, m_file.data(), sizeof(CheckpointHeader));
+
+		if (!isHeaderValid(t_filename) || (t_isDataChecked && !isDataValid(t_filename, t_threadPool))) {
+			close();
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	*	@brief  Unmaps the checkpoint. Pointers returned by getEncoding() are no longer valid.
+	*
+	*	@return void
+	*/
+	void CheckpointReader::close()
+	{
+		m_file.close();
+		std::memset(&m_header, 0, sizeof(CheckpointHeader));
+	}
+
+	bool CheckpointReader::isOpen() const
+	{
+		return m_file.isOpen();
+	}
+
+	const CheckpointHeader& CheckpointReader::getHeader() const
+	{
+		return m_header;
+	}
+
+	std::size_t CheckpointReader::getChromoCount() const
+	{
+		return static_cast<std::size_t>(m_header.chromoCount);
+	}
+
+	std::size_t CheckpointReader::getEncodedBytes() const
+	{
+		return static_cast<std::size_t>(m_header.encodedBytes);
+	}
+
+	/**
+	*	@brief  Returns a Chromo's encoded data, inside the mapped file.
+	*
+	*	@param  t_id specifies the Chromo
+	*	@return Pointer to getEncodedBytes() bytes
+	*/
+	const char* CheckpointReader::getEncoding(const std::size_t t_id) const
+	{
+		return m_file.data() + m_header.encodingsOffset + t_id * m_header.stride;
+	}
+
+	/**
+	*	@brief  Returns a Chromo's saved score.
+	*
+	*	@param  t_id specifies the Chromo
+	*	@return Score
+	*/
+	double CheckpointReader::getScore(const std::size_t t_id) const
+	{
+		double score;
+		std::memcpy(&score, m_file.data() + m_header.scoresOffset + t_id * sizeof(double), sizeof(double));
+		return score;
+	}
+
+	/**
+	*	@brief  Checks the header's identity, version, checksum, and layout against the file.
+	*
+	*	@param  t_filename specifies the filename, for error messages
+	*	@return true if the header is valid, false otherwise
+	*/
+	bool CheckpointReader::isHeaderValid(const std::string t_filename) const
+	{
+		if (std::memcmp(m_header.magic, checkpointMagic, sizeof(checkpointMagic)) != 0) {
+			std::cout << "\nERROR: " + t_filename + " is not a checkpoint.\n\n";
+			return false;
+		}
+		if (m_header.version == 0 || m_header.version > checkpointVersion) {
+			std::cout << "\nERROR: " + t_filename + " is checkpoint version " << m_header.version << ", which is newer than this code supports.\n\n";
+			return false;
+		}
+		if (m_header.headerBytes != sizeof(CheckpointHeader) || m_header.headerChecksum != hashCheckpointHeader(m_header)) {
+			std::cout << "\nERROR: The header of checkpoint " + t_filename + " is damaged.\n\n";
+			return false;
+		}
+
+		// The blocks must be where the layout says, and inside the file
+		CheckpointHeader layout;
+		initializeCheckpointHeader(layout, static_cast<std::size_t>(m_header.chromoCount), static_cast<std::size_t>(m_header.encodedBytes));
+		if (layout.stride != m_header.stride || layout.encodingsOffset != m_header.encodingsOffset ||
+			layout.scoresOffset != m_header.scoresOffset || layout.fileBytes != m_header.fileBytes || m_header.fileBytes > m_file.size())
+		{
+			std::cout << "\nERROR: Checkpoint " + t_filename + " is incomplete or has an invalid layout.\n\n";
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	*	@brief  Checks the encodings and scores against the data checksum.
+	*
+	*	@param  t_filename specifies the filename, for error messages
+	*	@param  t_threadPool specifies the threads to use, or nullptr
+	*	@return true if the data is valid, false otherwise
+	*/
+	bool CheckpointReader::isDataValid(const std::string t_filename, ThreadPool* t_threadPool)
+	{
+		const std::size_t chromoCount{ getChromoCount() };
+		const std::size_t stride{ static_cast<std::size_t>(m_header.stride) };
+		const char* encodings{ m_file.data() + m_header.encodingsOffset };
+		m_slotHashes.resize(chromoCount);
+
+		auto hashSlots = [this, encodings, stride](const std::size_t t_first, const std::size_t t_last)
+		{
+			for (std::size_t i{ t_first }; i < t_last; ++i) {
+				m_slotHashes[i] = hashEncodedData(encodings + i * stride, stride);
+			}
+		};
+		if (t_threadPool) {
+			t_threadPool->parallelFor(chromoCount, hashChunkSize, hashSlots);
+		}
+		else {
+			hashSlots(static_cast<std::size_t>(0), chromoCount);
+		}
+
+		const double* scores{ reinterpret_cast<const double*>(m_file.data() + m_header.scoresOffset) };
+		if (combineCheckpointHashes(m_slotHashes, scores, chromoCount) != m_header.dataChecksum) {
+			std::cout << "\nERROR: The data of checkpoint " + t_filename + " is damaged.\n\n";
+			return false;
+		}
+		return true;
+	}
+
+} // namespace ga
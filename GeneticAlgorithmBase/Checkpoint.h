@@ -0,0 +1,147 @@
+/**
+* @class Checkpoint.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains the versioned binary checkpoint format, and a reader that maps checkpoints into memory
+*
+* A checkpoint is a fixed-size header followed by two aligned blocks:
+*
+*	[CheckpointHeader][padding]
+*	[encodings: chromoCount slots of stride bytes, each zero padded]
+*	[scores: chromoCount doubles]
+*
+* The slot stride matches PopulationBuffer, so the encodings are laid out
+* exactly as a GA with contiguous storage holds them. The header records
+* a hash of the encoded partitions (so a checkpoint is never loaded into
+* a different Chromo), the GA's random state, its settings, and checksums
+* of the header and data. Values are stored little-endian.
+*
+* CheckpointReader maps the file, so the encodings and scores can be read
+* in place, without reading the file into memory first. Checkpoints are
+* written from a CheckpointSnapshot, to a temporary file which then
+* replaces the checkpoint, so a checkpoint is never left half written.
+* GeneticAlgorithm::writeCheckpoint() and readCheckpoint() use this format.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+#include "GeneticAlgorithmTechniques.h"
+#include "MappedFile.h"
+#include "ThreadPool.h"
+
+namespace ga
+{
+	// Version written by this code. Older versions can still be read.
+	const std::uint32_t checkpointVersion{ 1 };
+	// Alignment of each block within the file
+	const std::size_t checkpointAlignment{ 64 };
+
+	struct CheckpointHeader
+	{
+		// "GABCKPT" followed by a 0
+		char magic[8];
+		std::uint32_t version;
+		std::uint32_t headerBytes;
+
+		// Hash of the encoded partitions and mutation limits
+		std::uint64_t schemaHash;
+		std::uint64_t generation;
+
+		// Layout
+		std::uint64_t chromoCount;
+		std::uint64_t encodedBytes;
+		std::uint64_t stride;
+		std::uint64_t encodingsOffset;
+		std::uint64_t scoresOffset;
+		std::uint64_t fileBytes;
+
+		// The GA's random stream (see RandomGenerator::getState())
+		std::uint32_t randomEngine;
+		std::uint32_t reserved0;
+		std::uint64_t randomState[4];
+
+		// GA settings
+		std::uint64_t numEvolveCopy;
+		std::uint64_t numEvolveShuffle;
+		std::uint64_t numEvolveCrossover;
+		std::uint64_t numEvolveMutate;
+		std::uint64_t numCrossoverSplits;
+		std::uint64_t mutationCountMax;
+		std::uint64_t mutationBitWidth;
+		double mutationChance;
+		std::uint32_t mutationSelection;
+		std::uint32_t shuffleMode;
+		std::uint32_t parentSelection;
+		std::uint32_t reserved1;
+		std::uint64_t tournamentSize;
+		std::uint64_t truncationCount;
+
+		// Checksum of the encodings and scores (see combineCheckpointHashes())
+		std::uint64_t dataChecksum;
+		// Checksum of every byte above
+		std::uint64_t headerChecksum;
+	};
+
+	static_assert(std::is_standard_layout<CheckpointHeader>::value, "Checkpoint headers are written as raw bytes");
+	static_assert(sizeof(CheckpointHeader) % 8 == 0, "Checkpoint headers must not need padding");
+
+	// A copy of a GA's Chromos, laid out as they are written to a checkpoint
+	// Taking a snapshot only copies memory, so it can be written later, on another thread
+	struct CheckpointSnapshot
+	{
+		CheckpointHeader header;
+		// chromoCount slots of stride bytes, each zero padded
+		std::vector<char> encodings;
+		std::vector<double> scores;
+
+		std::size_t getBytes() const;
+	};
+
+	void initializeCheckpointHeader(CheckpointHeader&, const std::size_t, const std::size_t);
+	std::uint64_t hashCheckpointHeader(const CheckpointHeader&);
+	std::uint64_t hashEncodedPartitions(const std::vector<EncodedPartition>&, const MutationLimits);
+	std::uint64_t combineCheckpointHashes(const std::vector<std::uint64_t>&, const double*, const std::size_t);
+	bool writeCheckpointFile(CheckpointSnapshot&, const std::string, std::vector<std::uint64_t>&);
+
+	class CheckpointReader
+	{
+	public:
+		CheckpointReader() {};
+		~CheckpointReader() {};
+
+		bool open(const std::string, const bool = true, ThreadPool* = nullptr);
+		void close();
+		bool isOpen() const;
+
+		const CheckpointHeader& getHeader() const;
+		std::size_t getChromoCount() const;
+		std::size_t getEncodedBytes() const;
+		const char* getEncoding(const std::size_t) const;
+		double getScore(const std::size_t) const;
+
+	private:
+		bool isHeaderValid(const std::string) const;
+		bool isDataValid(const std::string, ThreadPool*);
+
+		MappedFile m_file;
+		CheckpointHeader m_header{};
+		// Hash of each slot, used to check the data (kept to avoid reallocating)
+		std::vector<std::uint64_t> m_slotHashes;
+	};
+
+} // namespace ga
+
+#endif	// CHECKPOINT_H_
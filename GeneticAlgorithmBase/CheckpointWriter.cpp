@@ -0,0 +1,169 @@
+#include "CheckpointWriter.h"
+
+namespace ga
+{
+	/**
+	*	@brief  Starts the writer thread, which sleeps until a snapshot is submitted.
+	*/
+	CheckpointWriter::CheckpointWriter()
+	{
+		m_thread = std::thread(&CheckpointWriter::writerLoop, this);
+	}
+
+	/**
+	*	@brief  Writes any queued snapshots, then joins the writer thread.
+	*/
+	CheckpointWriter::~CheckpointWriter()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_isStopping = true;
+		}
+		m_checkpointReady.notify_all();
+		m_thread.join();
+	}
+
+	/**
+	*	@brief  Returns a snapshot to fill, reusing a written one if possible.
+	*	If the snapshot would go over the memory limit while another
+	*	snapshot is pending, nullptr is returned instead.
+	*
+	*	@param  t_bytes specifies the encoding and score bytes the snapshot will hold
+	*	@return Snapshot to fill and submit(), or nullptr
+	*/
+	std::unique_ptr<CheckpointSnapshot> CheckpointWriter::acquireSnapshot(const std::size_t t_bytes)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_pendingCount > 0 && m_pendingBytes + t_bytes > m_memoryLimit) {
+			++m_refusedCount;
+			return nullptr;
+		}
+
+		std::unique_ptr<CheckpointSnapshot> snapshot;
+		if (m_spareSnapshot) {
+			snapshot = std::move(m_spareSnapshot);
+		}
+		else {
+			snapshot.reset(new CheckpointSnapshot());
+		}
+		return snapshot;
+	}
+
+	/**
+	*	@brief  Queues a snapshot from acquireSnapshot() to be written on the writer thread.
+	*	Snapshots are written in the order they are submitted. The
+	*	snapshot counts toward the memory limit until it has been written.
+	*
+	*	@param  t_snapshot specifies the filled snapshot
+	*	@param  t_filename specifies the path and filename of the checkpoint
+	*	@return void
+	*/
+	void CheckpointWriter::submit(std::unique_ptr<CheckpointSnapshot> t_snapshot, const std::string t_filename)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			PendingCheckpoint pending;
+			pending.bytes = t_snapshot->getBytes();
+			pending.snapshot = std::move(t_snapshot);
+			pending.filename = t_filename;
+			m_pendingBytes += pending.bytes;
+			++m_pendingCount;
+			m_pending.push_back(std::move(pending));
+		}
+		m_checkpointReady.notify_one();
+	}
+
+	/**
+	*	@brief  Blocks until every submitted snapshot has been written.
+	*
+	*	@return void
+	*/
+	void CheckpointWriter::waitUntilIdle()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_checkpointWritten.wait(lock, [this] { return m_pendingCount == 0; });
+	}
+
+	/**
+	*	@brief  Sets m_memoryLimit, the bytes pending snapshots may hold before new ones are refused.
+	*	One snapshot is always accepted when none are pending.
+	*
+	*	@param  t_memoryLimit specifies the limit in bytes (0 allows one snapshot at a time)
+	*	@return void
+	*/
+	void CheckpointWriter::setMemoryLimit(const std::size_t t_memoryLimit)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_memoryLimit = t_memoryLimit;
+	}
+
+	std::size_t CheckpointWriter::getMemoryLimit() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_memoryLimit;
+	}
+
+	std::size_t CheckpointWriter::getPendingBytes() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_pendingBytes;
+	}
+
+	unsigned long int CheckpointWriter::getWrittenCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_writtenCount;
+	}
+
+	unsigned long int CheckpointWriter::getFailedCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_failedCount;
+	}
+
+	unsigned long int CheckpointWriter::getRefusedCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_refusedCount;
+	}
+
+	/**
+	*	@brief  Main loop for the writer thread. Writes each queued snapshot, then sleeps until more arrive.
+	*	When stopping, every queued snapshot is still written.
+	*
+	*	@return void
+	*/
+	void CheckpointWriter::writerLoop()
+	{
+		while (true)
+		{
+			PendingCheckpoint pending;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_checkpointReady.wait(lock, [this] { return m_isStopping || !m_pending.empty(); });
+				if (m_pending.empty()) {
+					return;
+				}
+				pending = std::move(m_pending.front());
+				m_pending.pop_front();
+			}
+
+			const bool isWritten{ writeCheckpointFile(*pending.snapshot, pending.filename, m_slotHashes) };
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (isWritten) {
+					++m_writtenCount;
+				}
+				else {
+					++m_failedCount;
+				}
+				m_pendingBytes -= pending.bytes;
+				--m_pendingCount;
+				m_spareSnapshot = std::move(pending.snapshot);
+			}
+			m_checkpointWritten.notify_all();
+		}
+	}
+
+} // namespace ga
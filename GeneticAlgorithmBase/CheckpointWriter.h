@@ -0,0 +1,99 @@
+/**
+* @class CheckpointWriter.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a background thread which writes checkpoints while the GA keeps running
+*
+* The GA copies its Chromos into a CheckpointSnapshot, which only takes a
+* memcpy per Chromo, and hands the snapshot to the writer. The writer's
+* thread hashes and writes it (see writeCheckpointFile()), so the GA does
+* not wait for the disk. Snapshots are reused once written.
+*
+* The memory held by snapshots waiting to be written is capped. One
+* snapshot is always accepted when nothing is waiting, so checkpoints
+* are never blocked entirely. A snapshot that would go over the cap is
+* refused, and the GA tries again next generation, rather than waiting.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef CHECKPOINT_WRITER_H_
+#define CHECKPOINT_WRITER_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+#include "Checkpoint.h"
+
+namespace ga
+{
+	class CheckpointWriter
+	{
+	public:
+		CheckpointWriter();
+		~CheckpointWriter();
+
+		CheckpointWriter(const CheckpointWriter&) = delete;
+		CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+		// Returns a snapshot to fill, or nullptr if it would go over the memory limit
+		std::unique_ptr<CheckpointSnapshot> acquireSnapshot(const std::size_t);
+		// Queues a filled snapshot to be written to a file
+		void submit(std::unique_ptr<CheckpointSnapshot>, const std::string);
+		// Blocks until every queued snapshot has been written
+		void waitUntilIdle();
+
+		void setMemoryLimit(const std::size_t);
+		std::size_t getMemoryLimit() const;
+		std::size_t getPendingBytes() const;
+
+		unsigned long int getWrittenCount() const;
+		unsigned long int getFailedCount() const;
+		unsigned long int getRefusedCount() const;
+
+	private:
+		struct PendingCheckpoint
+		{
+			std::unique_ptr<CheckpointSnapshot> snapshot;
+			std::string filename;
+			std::size_t bytes{ 0 };
+		};
+
+		void writerLoop();
+
+		std::thread m_thread;
+		mutable std::mutex m_mutex;
+		std::condition_variable m_checkpointReady;
+		std::condition_variable m_checkpointWritten;
+
+		std::deque<PendingCheckpoint> m_pending;
+		// Written snapshot kept for reuse, so its buffers are not reallocated
+		std::unique_ptr<CheckpointSnapshot> m_spareSnapshot;
+		// Bytes of every snapshot submitted and not yet written
+		std::size_t m_pendingBytes{ 0 };
+		std::size_t m_pendingCount{ 0 };
+		// Snapshots are refused beyond this, unless none are pending (0 allows one at a time)
+		std::size_t m_memoryLimit{ 0 };
+
+		unsigned long int m_writtenCount{ 0 };
+		unsigned long int m_failedCount{ 0 };
+		unsigned long int m_refusedCount{ 0 };
+		bool m_isStopping{ false };
+
+		// Used only by the writer thread
+		std::vector<std::uint64_t> m_slotHashes;
+	};
+
+} // namespace ga
+
+#endif	// CHECKPOINT_WRITER_H_
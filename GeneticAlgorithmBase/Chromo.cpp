@@ -26,16 +26,16 @@ namespace ga
 	void Chromo::readFromFileAsBinary(std::ifstream& t_iStream)
 	{
 		// Read encoded size first
-		char* readMemSizeT;
-		readMemSizeT = new char[sizeof(std::size_t)];
-		t_iStream.read(readMemSizeT, sizeof(std::size_t));
-		std::size_t characters = *((std::size_t*)readMemSizeT);
+		std::size_t characters{ 0 };
+		t_iStream.read((char*) &characters, sizeof(std::size_t));
 		
 		// Now read string
 		m_encoded.resize(characters);
 		t_iStream.read(&m_encoded[0], characters);
-		
-		delete[] readMemSizeT;
+		m_isDecodingStale = true;
+
+		// Every byte may differ, so the score cannot be updated from tracked changes
+		markScoreStale();
 	}
 
 	/**
@@ -49,13 +49,63 @@ namespace ga
 	*	@return void
 	*/
 	void Chromo::writeToFileAsCSV(const std::size_t t_id, std::ofstream& t_oStream)
+	{
+		bif::CSVBuffer buffer;
+		writeToCSVBuffer(t_id, buffer);
+		buffer.endLine();
+		t_oStream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	}
+
+	/**
+	*	@brief  Writes Chromo data to a CSV line, without ending the line.
+	*	Like writeToFileAsCSV(), but the values are added to a buffer,
+	*	which is much faster than writing each value to a stream.
+	*
+	*	@param  t_id specifies the Chromo ID
+	*	@param  t_buffer specifies the buffer to add the line to
+	*	@return void
+	*/
+	void Chromo::writeToCSVBuffer(const std::size_t t_id, bif::CSVBuffer& t_buffer)
 	{
 		// Write CSV values that base class knows
-		t_oStream << std::to_string(t_id) << "," << getScore();
+		t_buffer.write(t_id);
+		t_buffer.write(getScore());
 
 		// Call virtual function to write data in inherited class
-		writeDataToCSV(t_oStream);
-		t_oStream << "\n";
+		writeDataToCSV(t_buffer);
+	}
+
+	/**
+	*	@brief  Writes the inherited class's values to a CSV line.
+	*	Classes that override this write their values straight into the
+	*	buffer. Otherwise, writeDataToCSV(std::ostream&) is written to a
+	*	string, which is added to the line as it is.
+	*
+	*	@param  t_buffer specifies the line, after the ID and score
+	*	@return void
+	*/
+	void Chromo::writeDataToCSV(bif::CSVBuffer& t_buffer)
+	{
+		std::ostringstream oStream;
+		writeDataToCSV(oStream);
+		const std::string values{ oStream.str() };
+		t_buffer.append(values.data(), values.length());
+	}
+
+	/**
+	*	@brief  Writes the inherited class's values to a CSV file stream, through writeDataToCSV(bif::CSVBuffer&).
+	*	Only call this from a class that overrides writeDataToCSV(bif::CSVBuffer&),
+	*	as the default would call writeDataToCSV(std::ostream&) again.
+	*
+	*	@param  t_oStream specifies the file stream, after the ID and score
+	*	@return void
+	*/
+	void Chromo::writeBufferedDataToCSV(std::ostream& t_oStream)
+	{
+		bif::CSVBuffer buffer;
+		buffer.continueLine();
+		writeDataToCSV(buffer);
+		t_oStream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
 	}
 
 	/**
@@ -70,23 +120,41 @@ namespace ga
 	*/
 	void Chromo::readFromFileAsCSV(std::ifstream& t_iStream)
 	{
-		// Read line as a vector of strings
+		// Read line, then walk through its values in place
 		std::string line;
 		std::getline(t_iStream, line);
-		std::vector<std::string> chromoValues = bif::Import::parseString(line, ",", bif::Import::CleanTokenBy::none);
+		bif::CSVCursor cursor(line);
 
 		// Get ID (not used) and score
 		std::size_t id;
 		double score;
-		stringToNumber(chromoValues.at(0), id);
-		stringToNumber(chromoValues.at(1), score);
+		cursor.read(id);
+		cursor.read(score);
 		setScore(score);
 
-		// Erase first 2 entries
-		chromoValues.erase(chromoValues.begin());
-		chromoValues.erase(chromoValues.begin());
-
 		// Call virtual function to read data in inherited class
+		readDataFromCSV(cursor);
+
+		// The saved score is kept for display, but limits may change the data
+		markVariablesChanged();
+	}
+
+	/**
+	*	@brief  Reads the rest of a CSV line into the inherited class.
+	*	Classes that override this read their values straight from the
+	*	line. Otherwise, the remaining values are split into strings
+	*	and passed to readDataFromCSV(std::vector<std::string>&).
+	*
+	*	@param  t_cursor specifies the line, positioned after the ID and score
+	*	@return void
+	*/
+	void Chromo::readDataFromCSV(bif::CSVCursor& t_cursor)
+	{
+		std::vector<std::string> chromoValues;
+		bif::TokenView token;
+		while (t_cursor.next(token)) {
+			chromoValues.push_back(token.toString());
+		}
 		readDataFromCSV(chromoValues);
 	}
 
@@ -106,12 +174,174 @@ namespace ga
 	*	@return m_score
 	*/
 	std::string Chromo::getEncoding() const
+	{
+		return m_encoded.toString();
+	}
+
+	/**
+	*	@brief  Replaces the Chromo's encoded string, such as with a migrant from another GA.
+	*	The Chromo's variables are not updated until decode() is called.
+	*
+	*	@param  t_encoded is the new encoded string
+	*	@return void
+	*/
+	void Chromo::setEncoding(const std::string& t_encoded)
+	{
+		m_encoded = t_encoded;
+		m_isScoreStale = true;
+		m_isDecodingStale = true;
+		m_changedPartitions.markAll();
+	}
+
+	/**
+	*	@brief  Replaces the Chromo's encoded data with raw bytes, such as from a mapped checkpoint.
+	*	The bytes are copied straight into the Chromo's storage, without a temporary string.
+	*
+	*	@param  t_data points to the new encoded data
+	*	@param  t_length specifies the number of bytes
+	*	@return void
+	*/
+	void Chromo::setEncoding(const char* t_data, const std::size_t t_length)
+	{
+		m_encoded.assign(t_data, t_length);
+		m_isScoreStale = true;
+		m_isDecodingStale = true;
+		m_changedPartitions.markAll();
+	}
+
+	/**
+	*	@brief  Returns the Chromo's encoded data, without copying it.
+	*
+	*	@return m_encoded
+	*/
+	const EncodedData& Chromo::getEncodedData() const
 	{
 		return m_encoded;
 	}
 
+	/**
+	*	@brief  Returns true if the Chromo has been encoded at least once.
+	*
+	*	@return true if the encoded string is not empty
+	*/
+	bool Chromo::isEncoded() const
+	{
+		return !m_encoded.empty();
+	}
+
+	/**
+	*	@brief  Returns a hash of the encoded string, used to look up cached fitness scores.
+	*
+	*	@return 64-bit hash of m_encoded
+	*/
+	std::uint64_t Chromo::getEncodingHash() const
+	{
+		return hashEncodedData(m_encoded.data(), m_encoded.length());
+	}
+
+	/**
+	*	@brief  Returns true if the data has changed since the fitness function last set the score.
+	*
+	*	@return m_isScoreStale
+	*/
+	bool Chromo::isScoreStale() const
+	{
+		return m_isScoreStale;
+	}
+
+	/**
+	*	@brief  Forces the fitness function to run again during the next selection phase.
+	*
+	*	@return void
+	*/
+	void Chromo::markScoreStale()
+	{
+		m_isScoreStale = true;
+		m_changedPartitions.markAll();
+	}
+
+	/**
+	*	@brief  Returns true if the variables have changed since the last call to encode().
+	*
+	*	@return m_isEncodingStale
+	*/
+	bool Chromo::isEncodingStale() const
+	{
+		return m_isEncodingStale;
+	}
+
+	/**
+	*	@brief  Returns true if the encoded string has changed since the last call to decode().
+	*
+	*	@return m_isDecodingStale
+	*/
+	bool Chromo::isDecodingStale() const
+	{
+		return m_isDecodingStale;
+	}
+
+	/**
+	*	@brief  Marks the variables as changed, so the Chromo will be encoded and scored again.
+	*	Call this after changing a Chromo's variables outside of the GA.
+	*
+	*	@return void
+	*/
+	void Chromo::markVariablesChanged()
+	{
+		m_isEncodingStale = true;
+		m_isScoreStale = true;
+		m_changedPartitions.markAll();
+	}
+
+	/**
+	*	@brief  Marks the encoded string as out of date, without affecting the score.
+	*	Used after applyLimits(), which may change variables without
+	*	changing what they score.
+	*
+	*	@return void
+	*/
+	void Chromo::markEncodingStale()
+	{
+		m_isEncodingStale = true;
+	}
+
+	/**
+	*	@brief  Records that encode() has been called. Called by GeneticAlgorithm.
+	*
+	*	@return void
+	*/
+	void Chromo::markEncoded()
+	{
+		m_isEncodingStale = false;
+	}
+
+	/**
+	*	@brief  Records that decode() has been called. Called by GeneticAlgorithm.
+	*
+	*	@return void
+	*/
+	void Chromo::markDecoded()
+	{
+		m_isDecodingStale = false;
+	}
+
+	/**
+	*	@brief  Sets a score found without running the fitness function, such as from a FitnessCache.
+	*
+	*	@param  t_score is the known score for the current data
+	*	@return void
+	*/
+	void Chromo::restoreScore(const double t_score)
+	{
+		setScore(t_score);
+		// Any fitness terms belong to other data, so the next change is scored in full
+		m_changedPartitions.markAll();
+	}
+
 	/**
 	*	@brief  Sets the fitness score.
+	*	The score is no longer stale, until the data changes again.
+	*	With change tracking, later changes are recorded against the data scored here.
 	*
 	*	@param  t_score is the new score
 	*	@return void
@@ -119,6 +349,79 @@ namespace ga
 	void Chromo::setScore(double t_score)
 	{
 		m_score = t_score;
+		m_isScoreStale = false;
+		m_changedPartitions.clear();
+		if (m_scoreSlot.score) {
+			*m_scoreSlot.score = t_score;
+		}
+	}
+
+	/**
+	*	@brief  Moves the encoded data and score into a slot of a PopulationBuffer.
+	*	The score is also kept in the Chromo, so getScore() does not change.
+	*
+	*	@param  t_population specifies the buffer
+	*	@param  t_slot specifies the slot within the buffer
+	*	@return true if the Chromo was bound, false if its encoded data does not fit the slot
+	*/
+	bool Chromo::bindToPopulation(PopulationBuffer& t_population, const std::size_t t_slot)
+	{
+		if (!m_encoded.bind(t_population.getSlot(t_slot), t_population.getStride())) {
+			return false;
+		}
+		m_scoreSlot.score = t_population.getScoreSlot(t_slot);
+		*m_scoreSlot.score = m_score;
+		return true;
+	}
+
+	/**
+	*	@brief  Moves the encoded data out of its PopulationBuffer slot.
+	*	Must be called before the PopulationBuffer is released.
+	*
+	*	@return void
+	*/
+	void Chromo::unbindFromPopulation()
+	{
+		m_encoded.unbind();
+		m_scoreSlot.score = nullptr;
+	}
+
+	/**
+	*	@brief  Starts recording which partitions change, for updateFitness(). Called by GeneticAlgorithm
+	*	when the Chromo class declares hasFitnessUpdate() as true. Tracking keeps a
+	*	copy of each changed partition's previous bytes, so it needs up to the
+	*	size of the encoded data in extra memory.
+	*
+	*	@param  t_encodedPartitions specifies the partitions of the encoded data, which must outlive this Chromo
+	*	@return void
+	*/
+	void Chromo::enableChangeTracking(const std::vector<EncodedPartition>& t_encodedPartitions)
+	{
+		m_changedPartitions.enable(t_encodedPartitions);
+		if (!m_isScoreStale) {
+			m_changedPartitions.clear();
+		}
+	}
+
+	/**
+	*	@brief  Returns the partitions changed since the score was set.
+	*
+	*	@return m_changedPartitions
+	*/
+	const ChangedPartitions& Chromo::getChangedPartitions() const
+	{
+		return m_changedPartitions;
+	}
+
+	/**
+	*	@brief  Returns true if the score is stale, and every change since it was set is known.
+	*	getScore() then returns the score before the changes.
+	*
+	*	@return true if updateFitness() may be called
+	*/
+	bool Chromo::canUpdateFitness() const
+	{
+		return m_isScoreStale && m_changedPartitions.isEnabled() && !m_changedPartitions.isAllChanged();
 	}
 
 	/**
@@ -127,15 +430,19 @@ namespace ga
 	*
 	*	@param  t_encodedPartitions is a vector of indices that identifies where values are in the encoded string
 	*   @param  t_mutationMode is a MutationMode enum specifying how mutations are handled
-	*	@return void
+	*   @param  t_mutationChance is the chance of each bit within a mutation block being toggled, in [0, 1]
+	*	@return Number of encoded bytes covered by the mutations
 	*/
-	void Chromo::mutate(std::vector<EncodedPartition>& t_encodedPartitions, const MutationLimits t_mutationLimits, const MutationSelection t_mutationSelection,
-		const std::size_t t_mutationCountMax, const std::size_t t_mutationBitWidth, const short int t_mutationChanceIn100)
+	std::size_t Chromo::mutate(std::vector<EncodedPartition>& t_encodedPartitions, const MutationLimits t_mutationLimits, const MutationSelection t_mutationSelection,
+		const std::size_t t_mutationCountMax, const std::size_t t_mutationBitWidth, const double t_mutationChance)
 	{
 		const std::size_t mutationCount{ m_randomGenerator() % t_mutationCountMax + 1 };
 		//std::cout << "\n[" << m_encoded << "] to";
-		mutateRandomBits(m_encoded, t_encodedPartitions, t_mutationLimits, t_mutationSelection, mutationCount, t_mutationBitWidth, t_mutationChanceIn100, m_randomGenerator);
+		const std::size_t mutatedBytes{ mutateRandomBits(m_encoded, t_encodedPartitions, t_mutationLimits, t_mutationSelection, mutationCount, t_mutationBitWidth, t_mutationChance, m_randomGenerator, &m_changedPartitions) };
 		//std::cout << "\n[" << m_encoded << "]";
+		m_isScoreStale = true;
+		m_isDecodingStale = true;
+		return mutatedBytes;
 	}
 
 	/**
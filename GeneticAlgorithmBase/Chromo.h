@@ -16,35 +16,76 @@
 
 #include <vector>
 #include <iostream>
+#include <cstdint>
 #include "GeneticAlgorithm.h"
 #include "GeneticAlgorithmTechniques.h"
 #include "ChromoSerialization.h"
 #include "ImportData.h"
+#include "RandomGenerator.h"
+#include "EncodedData.h"
+#include "ChangedPartitions.h"
+#include "PopulationBuffer.h"
 
 namespace ga
 {
 	class Chromo
 	{
 	public:
-		explicit Chromo(const int t_initialStateId, int(*t_randomGenerator)(void))
+		explicit Chromo(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
 			: m_randomGenerator(t_randomGenerator)
 		{ };
 		virtual ~Chromo() {};
 
 		double getScore() const;
 		std::string getEncoding() const;
+		void setEncoding(const std::string&);
+		void setEncoding(const char*, const std::size_t);
+		const EncodedData& getEncodedData() const;
+		bool isEncoded() const;
+		std::uint64_t getEncodingHash() const;
+
+		// Dirty tracking
+		// A Chromo only needs a new score when its data has changed,
+		// and only needs encoding or decoding when the other side has changed
+		bool isScoreStale() const;
+		void markScoreStale();
+		void restoreScore(const double);
+		bool isEncodingStale() const;
+		bool isDecodingStale() const;
+		void markVariablesChanged();
+		void markEncodingStale();
+		void markEncoded();
+		void markDecoded();
+
+		// Contiguous storage (see PopulationBuffer.h)
+		bool bindToPopulation(PopulationBuffer&, const std::size_t);
+		void unbindFromPopulation();
 
 		// Evolutionary default functions
 		// Often overidden in derived classes
 		template <typename C>
 		void copyParent(const C&);
 		template <typename C>
-		void shuffleFromParents(const C&, const C&);
+		void shuffleFromParents(const C&, const C&, const ShuffleMode = ShuffleMode::byte);
 		template <typename C>
 		void crossoverFromParents(const C&, const C&, const std::size_t);
-		void mutate(std::vector<EncodedPartition>&, const MutationLimits, const MutationSelection, const std::size_t, const std::size_t, const short int);
+		std::size_t mutate(std::vector<EncodedPartition>&, const MutationLimits, const MutationSelection, const std::size_t, const std::size_t, const double);
 		virtual void mutateCustom() = 0;
 
+		// Fitness function for many Chromos at once
+		// The default scores each Chromo with runFitnessFunctionLocal()
+		// Hide this in a derived class to share setup between Chromos
+		template <typename C>
+		static void runFitnessFunctionBatch(C* const*, const std::size_t);
+
+		// Delta fitness (see ChangedPartitions.h)
+		// Hide both in a derived class to update the previous score from only the changed partitions
+		static bool hasFitnessUpdate() { return false; };
+		bool updateFitness(const double, const ChangedPartitions&) { return false; };
+		void enableChangeTracking(const std::vector<EncodedPartition>&);
+		const ChangedPartitions& getChangedPartitions() const;
+		bool canUpdateFitness() const;
+
 		// Pure virtual functions, required to be overridden by derived classes
 		virtual void encode() = 0;
 		virtual void decode() = 0;
@@ -55,6 +96,7 @@ namespace ga
 		void writeToFileAsBinary(std::ofstream&);
 		void readFromFileAsBinary(std::ifstream&);
 		void writeToFileAsCSV(const std::size_t, std::ofstream&);
+		void writeToCSVBuffer(const std::size_t, bif::CSVBuffer&);
 		void readFromFileAsCSV(std::ifstream&);
 
 		friend std::ostream &operator<<(std::ostream& output, const Chromo& self) {
@@ -68,19 +110,55 @@ namespace ga
 	protected:
 		void setScore(double);
 		virtual void writeDataToCSV(std::ostream&) = 0;
+		// Writes values straight into a CSV line (see bif::CSVBuffer)
+		// The default writes writeDataToCSV(std::ostream&) to a string, then adds the string to the line
+		virtual void writeDataToCSV(bif::CSVBuffer&);
+		// Writes writeDataToCSV(bif::CSVBuffer&) to a stream
+		// Classes that override it can call this from writeDataToCSV(std::ostream&)
+		void writeBufferedDataToCSV(std::ostream&);
 		virtual void readDataFromCSV(std::vector<std::string>&) = 0;
+		// Reads values straight from the CSV line (see bif::CSVCursor)
+		// The default splits the rest of the line into strings for readDataFromCSV(std::vector<std::string>&)
+		virtual void readDataFromCSV(bif::CSVCursor&);
 
-		std::string m_encoded;
-		int(*m_randomGenerator)(void);
+		EncodedData m_encoded;
+		// Each Chromo owns its own random stream
+		RandomGenerator m_randomGenerator;
+		// Running totals behind the score, kept by the fitness function for updateFitness()
+		// These are copied along with the score by copyParent() and crossovers
+		std::vector<double> m_fitnessTerms;
 
 	private:
+		template <typename C>
+		void trackChangesFromParents(const C&, const C&);
+
+		// Points to this Chromo's score in a PopulationBuffer, if bound
+		// Copies of a Chromo are never bound
+		struct ScoreSlot
+		{
+			double* score{ nullptr };
+			ScoreSlot() {};
+			ScoreSlot(const ScoreSlot&) {};
+			ScoreSlot& operator=(const ScoreSlot&) { return *this; };
+		};
+
 		double m_score{ 0.0 };
+		ScoreSlot m_scoreSlot;
+		// True if the data has changed since the fitness function last ran
+		bool m_isScoreStale{ true };
+		// True if the variables have changed since the last encode()
+		bool m_isEncodingStale{ true };
+		// True if the encoded string has changed since the last decode()
+		bool m_isDecodingStale{ false };
+		// Partitions changed since the score was set (only tracked if enabled)
+		ChangedPartitions m_changedPartitions;
 	};
 
 	// Implement templated functions here, rather than in the cpp file
 
 	/**
 	*	@brief  Copies the encoded data from another chromo.
+	*	The parent's score is copied too, since the data is identical.
 	*
 	*	@param  t_parent specifies the Chromo to copy from
 	*	@return void
@@ -89,19 +167,53 @@ namespace ga
 	void Chromo::copyParent(const C& t_parent)
 	{
 		m_encoded = t_parent.m_encoded;
+		setScore(t_parent.getScore());
+		m_isScoreStale = t_parent.isScoreStale();
+		m_isDecodingStale = true;
+		m_fitnessTerms = t_parent.m_fitnessTerms;
+		if (m_isScoreStale || !t_parent.getChangedPartitions().isEmpty()) {
+			m_changedPartitions.markAll();
+		}
 	}
 
 	/**
-	*	@brief  Copies the encoded data from two sources, randomly choosing each byte from the sources.
+	*	@brief  Runs the fitness function on a span of Chromos.
+	*	GeneticAlgorithm always scores Chromos through this function, so a
+	*	derived class can declare its own static runFitnessFunctionBatch()
+	*	to score many Chromos together. This can hoist setup out of the
+	*	loop, or work on many Chromos at once with SIMD. Every Chromo in
+	*	the span must have its score set.
+	*
+	*	With parallel fitness, spans are scored on several threads at
+	*	once, so this must only modify the Chromos it is given.
+	*
+	*	@param  t_chromos points to the first Chromo to score
+	*	@param  t_count specifies the number of Chromos
+	*	@return void
+	*/
+	template <typename C>
+	void Chromo::runFitnessFunctionBatch(C* const* t_chromos, const std::size_t t_count)
+	{
+		for (std::size_t i{ 0 }; i < t_count; ++i) {
+			t_chromos[i]->runFitnessFunctionLocal();
+		}
+	}
+
+	/**
+	*	@brief  Copies the encoded data from two sources, randomly choosing each byte (or bit) from the sources.
 	*
 	*	@param  t_parent1 specifies the first parent to copy from
 	*	@param  t_parent2 specifies the second parent to copy from
+	*	@param  t_shuffleMode specifies whether to choose bytes or bits
 	*	@return void
 	*/
 	template <typename C>
-	void Chromo::shuffleFromParents(const C& t_parent1, const C& t_parent2)
+	void Chromo::shuffleFromParents(const C& t_parent1, const C& t_parent2, const ShuffleMode t_shuffleMode)
 	{
-		m_encoded = shuffleEncodedData(t_parent1.m_encoded, t_parent2.m_encoded, m_randomGenerator);
+		shuffleEncodedData(t_parent1.m_encoded, t_parent2.m_encoded, m_encoded, m_randomGenerator, t_shuffleMode);
+		m_isScoreStale = true;
+		m_isDecodingStale = true;
+		trackChangesFromParents(t_parent1, t_parent2);
 	}
 
 	/**
@@ -117,7 +229,48 @@ namespace ga
 	template <typename C>
 	void Chromo::crossoverFromParents(const C& t_parent1, const C& t_parent2, const std::size_t t_numSplits)
 	{
-		m_encoded = nSplitEncodedData(t_parent1.m_encoded, t_parent2.m_encoded, t_numSplits, m_randomGenerator);
+		nSplitEncodedData(t_parent1.m_encoded, t_parent2.m_encoded, m_encoded, t_numSplits, m_randomGenerator);
+		m_isScoreStale = true;
+		m_isDecodingStale = true;
+		trackChangesFromParents(t_parent1, t_parent2);
+	}
+
+	/**
+	*	@brief  Records the partitions a crossover changed, relative to a parent.
+	*	The first parent with an up-to-date score (and no pending changes) is
+	*	taken as the starting point: its score and fitness terms are copied,
+	*	and every partition that differs from it is marked. If nothing
+	*	differs, the parent's score is kept. Without such a parent, every
+	*	partition is marked as changed.
+	*
+	*	@param  t_parent1 specifies the first parent
+	*	@param  t_parent2 specifies the second parent
+	*	@return void
+	*/
+	template <typename C>
+	void Chromo::trackChangesFromParents(const C& t_parent1, const C& t_parent2)
+	{
+		if (!m_changedPartitions.isEnabled()) {
+			return;
+		}
+
+		const Chromo* parent{ nullptr };
+		if (!t_parent1.isScoreStale() && t_parent1.getChangedPartitions().isEmpty()) {
+			parent = &t_parent1;
+		}
+		else if (!t_parent2.isScoreStale() && t_parent2.getChangedPartitions().isEmpty()) {
+			parent = &t_parent2;
+		}
+		if (parent == nullptr || parent->m_encoded.length() != m_encoded.length())
+		{
+			m_changedPartitions.markAll();
+			return;
+		}
+
+		setScore(parent->getScore());
+		m_fitnessTerms = parent->m_fitnessTerms;
+		m_changedPartitions.markDifferences(parent->m_encoded.data(), m_encoded.data(), m_encoded.length());
+		m_isScoreStale = !m_changedPartitions.isEmpty();
 	}
 
 } // namespace ga
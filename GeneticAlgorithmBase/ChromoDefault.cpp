@@ -47,6 +47,22 @@ namespace ga
 		//	bif::Import::writeBoolVectorToCSVStream(t_oStream, bools);
 	}
 
+	/**
+	*	@brief  Writes Chromo data straight into a CSV line, without a stream
+	*	This is faster than writeDataToCSV(std::ostream&),
+	*	which is only used if this method is removed.
+	*
+	*	@param  t_buffer specifies the line, after the ID and score
+	*	@return void
+	*/
+	void ChromoDefault::writeDataToCSV(bif::CSVBuffer& /*t_buffer*/)
+	{
+		// TODO: Write data to t_buffer
+		// EXAMPLE:
+		//	t_buffer.writeVector(ints);
+		//	t_buffer.writeBoolVector(bools);
+	}
+
 	/**
 	*	@brief  Reads Chromo data from a CSV line
 	*
@@ -61,6 +77,22 @@ namespace ga
 		//	bools = bif::Import::vectorStringToBoolVector(chromoValues, 10);
 	}
 
+	/**
+	*	@brief  Reads Chromo data straight from a CSV line, without splitting it into strings
+	*	This is faster than readDataFromCSV(std::vector<std::string>&),
+	*	which is only used if this method is removed.
+	*
+	*	@param  t_cursor specifies the line, positioned after the ID and score
+	*	@return void
+	*/
+	void ChromoDefault::readDataFromCSV(bif::CSVCursor& /*t_cursor*/)
+	{
+		// TODO: Read data from t_cursor
+		// EXAMPLE:
+		//	t_cursor.readVector(ints, 5);
+		//	t_cursor.readBoolVector(bools, 10);
+	}
+
 	/**
 	*	@brief  This is a static function used by GeneticAlgorithm.h to obtain the data partitions within the encoded chromosome.
 	*
@@ -113,8 +145,8 @@ namespace ga
 
 		// TODO: Add data values to encoded string, using methods from static libraries
 		// EXAMPLE:
-		//	m_encoded += encodeVector(ints);
-		//	m_encoded += encodeBoolVector(bools);
+		//	appendEncodedVector(m_encoded, ints);
+		//	appendEncodedBoolVector(m_encoded, bools);
 	}
 
 	/**
@@ -22,7 +22,7 @@ namespace ga
 	class ChromoDefault : public Chromo
 	{
 	public:
-		explicit ChromoDefault(const int t_initialStateId, int(*t_randomGenerator)(void))
+		explicit ChromoDefault(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
 			: Chromo(t_initialStateId, t_randomGenerator)
 		{
 			initializeValues(t_initialStateId);
@@ -57,7 +57,9 @@ namespace ga
 	protected:
 		// Input/output
 		void writeDataToCSV(std::ostream&);
+		void writeDataToCSV(bif::CSVBuffer&);
 		void readDataFromCSV(std::vector<std::string>&);
+		void readDataFromCSV(bif::CSVCursor&);
 
 	private:
 		// Data used in fitness function
@@ -2,6 +2,20 @@
 
 namespace ga
 {
+	namespace
+	{
+		// Each item has a certain value and weight
+		// These are shared by every Chromo, so they are only built once
+		const std::size_t itemCount{ 16 };
+		const short itemWeights[itemCount]{ 30, 40, 23, 46, 11, 6, 87, 5, 64, 97, 23, 45, 21, 21, 64, 3 };
+		const short itemValues[itemCount]{ 28, 41, 25, 45, 8, 4, 100, 1, 60, 110, 24, 46, 20, 21, 63, 2 };
+
+		// Number of Chromos scored together by runFitnessFunctionBatch()
+		const std::size_t batchBlockSize{ 64 };
+
+		static_assert(KnapsackItems::count == itemCount, "Every item needs a weight and value");
+	}
+
 	/**
 	*	@brief  Sets up any initial values for this chromosome.
 	*	Fill your vectors with values here.
@@ -11,8 +25,9 @@ namespace ga
 	*/
 	void ChromoKnapsack::initializeValues(const int t_initialStateId)
 	{
-		for (std::size_t i{ 0 }; i < 16; ++i) {
-			hasItem.push_back(false);
+		auto hasItem = getValues<KnapsackItems>();
+		for (std::size_t i{ 0 }; i < hasItem.size(); ++i) {
+			hasItem[i] = false;
 		}
 	}
 
@@ -25,50 +40,12 @@ namespace ga
 	*	@return Output stream
 	*/
 	std::ostream& operator<<(std::ostream& t_output, const ChromoKnapsack& self) {
-		t_output << self.hasItem;
+		t_output << self.getValues<KnapsackItems>();
 		t_output << "\t Score = " << self.getScore();
 		//t_output << ", \tencoded = [[" << self.m_encoded << "]]";
 		return t_output;
 	}
 
-	/**
-	*	@brief  Writes Chromo data to a CSV file stream.
-	*
-	*	@param  t_oStream specifies the file stream to write to
-	*	@return void
-	*/
-	void ChromoKnapsack::writeDataToCSV(std::ostream& oStream)
-	{
-		bif::Import::writeBoolVectorToCSVStream(oStream, hasItem);
-	}
-
-	/**
-	*	@brief  Reads Chromo data from a CSV line
-	*
-	*	@param  t_chromoValues is a vector of strings containing the CSV row values
-	*	@return void
-	*/
-	void ChromoKnapsack::readDataFromCSV(std::vector<std::string>& chromoValues)
-	{
-		hasItem = bif::Import::vectorStringToBoolVector(chromoValues, 16);
-	}
-
-	/**
-	*	@brief  This is a static function used by GeneticAlgorithm.h to obtain the data partitions within the encoded chromosome.
-	*
-	*	@param  t_indices specifies the vector of partitions to be modified
-	*   @param  t_mutateBytes specifies the number of bytes allowed for the crossover and mutation phases
-	*	@return void
-	*/
-	void ChromoKnapsack::getEncodedPartitions(std::vector<EncodedPartition>& t_indices, MutationLimits& t_mutationLimits)
-	{
-		t_indices.clear();
-		std::size_t location{ 0 };
-		t_mutationLimits.bytes = 0;
-		t_mutationLimits.partitions = 0;
-		Chromo::addItemIndicesOfBoolVector(t_indices, t_mutationLimits, location, 16, "Bools", true);
-	}
-
 	/**
 	*	@brief  Runs the fitness function for this chromosome. This operates locally and does not affect other chromosomes that are being tested.
 	*	This fitness function sets the score equal to the sum of the
@@ -78,60 +55,60 @@ namespace ga
 	*/
 	void ChromoKnapsack::runFitnessFunctionLocal()
 	{
-		short sumValue{ 0 };
-		short sumWeight{ 0 };
-
-		// Each item has a certain value and weight
-		std::vector<short> weights{ 30, 40, 23, 46, 11, 6, 87, 5, 64, 97, 23, 45, 21, 21, 64, 3 };
-		std::vector<short> values{ 28, 41, 25, 45, 8, 4, 100, 1, 60, 110, 24, 46, 20, 21, 63, 2 };
-		for (std::size_t i{ 0 }; i < hasItem.size(); ++i) {
-			if (hasItem.at(i)) {
-				sumValue += weights.at(i);
-				sumWeight += values.at(i);
-			}
-		}
-
-		// Must be under weight limit
-		if (sumWeight < 100) {
-			Chromo::setScore(sumValue + 1);
-		}
-		else {
-			Chromo::setScore(0);
-		}
+		ChromoKnapsack* self{ this };
+		runFitnessFunctionBatch(&self, 1);
 	}
 
 	/**
-	*	@brief  Converts chromosome data values into a string meant to be crossed over and/or mutated.
+	*	@brief  Runs the fitness function on many chromosomes at once.
+	*	Chromos are scored in blocks. The items of each Chromo in a block
+	*	are packed into a bit mask, then each item is added to every Chromo
+	*	in the block. The inner loops have no branches, so the compiler
+	*	can vectorize them across Chromos.
 	*
+	*	@param  t_chromos points to the first Chromo to score
+	*	@param  t_count specifies the number of Chromos
 	*	@return void
 	*/
-	void ChromoKnapsack::encode()
+	void ChromoKnapsack::runFitnessFunctionBatch(ChromoKnapsack* const* t_chromos, const std::size_t t_count)
 	{
-		m_encoded = "";
-
-		// Calculate string size needed
-		std::size_t encodedSize{ 0 };
-		encodedSize += sizeof(bool) * hasItem.size();
-
-		// Reserve string memory
-		m_encoded.reserve(encodedSize + 1);
+		std::uint32_t itemMasks[batchBlockSize];
+		short sumValues[batchBlockSize];
+		short sumWeights[batchBlockSize];
+
+		for (std::size_t first{ 0 }; first < t_count; first += batchBlockSize)
+		{
+			const std::size_t blockSize{ std::min(batchBlockSize, t_count - first) };
+
+			// Gather items into bit masks
+			// The encoded data already holds the items as bits, in little-endian order
+			for (std::size_t j{ 0 }; j < blockSize; ++j)
+			{
+				const auto hasItem = t_chromos[first + j]->getValues<KnapsackItems>();
+				std::uint32_t mask{ 0 };
+				std::memcpy(&mask, hasItem.data(), KnapsackItems::bytes);
+				itemMasks[j] = mask;
+				sumValues[j] = 0;
+				sumWeights[j] = 0;
+			}
 
-		m_encoded += encodeBoolVector(hasItem);
-	}
+			// Add each item to every Chromo that has it
+			for (std::size_t i{ 0 }; i < itemCount; ++i)
+			{
+				const short weight{ itemWeights[i] };
+				const short value{ itemValues[i] };
+				for (std::size_t j{ 0 }; j < blockSize; ++j)
+				{
+					const short isTaken{ static_cast<short>((itemMasks[j] >> i) & 1) };
+					sumValues[j] += isTaken * value;
+					sumWeights[j] += isTaken * weight;
+				}
+			}
 
-	/**
-	*	@brief  Converts the encoded string into data values used in fitness function.
-	*
-	*	@return void
-	*/
-	void ChromoKnapsack::decode()
-	{
-		if (m_encoded.length() > 0) {
-			std::size_t curStrIndex{ 0 };
-			curStrIndex = decodeBoolVector(hasItem, m_encoded, curStrIndex);
-		}
-		else {
-			std::cout << "ERROR: Encoded string not found!";
+			// Must be under weight limit
+			for (std::size_t j{ 0 }; j < blockSize; ++j) {
+				t_chromos[first + j]->setScore(sumWeights[j] < 100 ? sumValues[j] + 1 : 0);
+			}
 		}
 	}
 
@@ -147,14 +124,4 @@ namespace ga
 		// No custom mutations required!
 	}
 
-	/**
-	*	@brief  Applies limits to data values.
-	*
-	*	@return void
-	*/
-	void ChromoKnapsack::applyLimits()
-	{
-		// No limits required!
-	}
-
 } // namespace ga
\ No newline at end of file
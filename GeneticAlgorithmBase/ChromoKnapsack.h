@@ -14,15 +14,27 @@
 #pragma once
 #endif	// _MSC_VER
 
-#include "Chromo.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "GenomeSchema.h"
 
 namespace ga
 {
-	class ChromoKnapsack : public Chromo
+	// Whether each item is in the bag
+	struct KnapsackItems : GenomeBits<16>
+	{
+		static const char* name() { return "Bools"; }
+	};
+
+	// Encoding, partitions and file I/O are generated from this schema
+	// The items are read straight from the encoded data, so there is nothing to encode or decode
+	class ChromoKnapsack : public SchemaChromo<GenomeSchema<KnapsackItems>, true>
 	{
 	public:
-		explicit ChromoKnapsack(const int t_initialStateId, int(*t_randomGenerator)(void))
-			: Chromo(t_initialStateId, t_randomGenerator)
+		explicit ChromoKnapsack(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
+			: SchemaChromo(t_initialStateId, t_randomGenerator)
 		{
 			initializeValues(t_initialStateId);
 		};
@@ -33,6 +45,8 @@ namespace ga
 		// Run the fitness function on only this chromosome,
 		// rather than in a larger simulation
 		void runFitnessFunctionLocal();
+		// Run the fitness function on many chromosomes at once
+		static void runFitnessFunctionBatch(ChromoKnapsack* const*, const std::size_t);
 
 		// Custom mutations for certain data
 		// Most commonly adding/subtracting by random amount rather than flipping bits
@@ -40,27 +54,8 @@ namespace ga
 		void mutateCustom();
 		const static bool hasCustomMutations() { return false; };
 
-		// Data processing that enables
-		// crossover and mutation phases,
-		// as well as file I/O
-		void encode();
-		void decode();
-		void applyLimits();
-
-		// Extra info to be used during crossovers and mutations
-		static void getEncodedPartitions(std::vector<EncodedPartition>&, MutationLimits&);
-
 		// Custom output
 		friend std::ostream& operator<<(std::ostream&, const ChromoKnapsack&);
-
-	protected:
-		// Input/output
-		void writeDataToCSV(std::ostream&);
-		void readDataFromCSV(std::vector<std::string>&);
-
-	private:
-		// Data used in fitness function
-		std::vector<bool> hasItem;
 	};
 
 } // namespace ga
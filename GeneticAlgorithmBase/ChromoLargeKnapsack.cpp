@@ -0,0 +1,305 @@
+#include "ChromoLargeKnapsack.h"
+
+#include <algorithm>
+
+namespace ga
+{
+	namespace
+	{
+		// Shared by every Chromo, and empty until setProblem() is called
+		std::shared_ptr<const KnapsackProblem>& sharedProblem()
+		{
+			static std::shared_ptr<const KnapsackProblem> problem{ std::make_shared<KnapsackProblem>() };
+			return problem;
+		}
+	}
+
+	/**
+	*	@brief  Sets up any initial values for this chromosome.
+	*	The bag starts empty, or with about 1 in 4 items taken at random if t_initialStateId is not 0.
+	*
+	*	@param  t_initialStateId is a value sent to the GeneticAlgorithm class and routed here. It is an easy way to start the chromosome from different states.
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::initializeValues(const int t_initialStateId)
+	{
+		const std::size_t bytes{ getProblem().getSelectionBytes() };
+		m_encoded.resize(bytes);
+		for (std::size_t i{ 0 }; i < bytes; ++i) {
+			m_encoded[i] = (t_initialStateId != 0) ? static_cast<char>(m_randomGenerator.nextU32() & m_randomGenerator.nextU32()) : 0;
+		}
+		applyLimits();
+	}
+
+	/**
+	*	@brief  Sets the items used by every ChromoLargeKnapsack.
+	*	Call this before creating a GeneticAlgorithm, as the size of the
+	*	encoded data is taken from the number of items.
+	*
+	*	@param  t_problem specifies the items, or nullptr to clear them
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::setProblem(const std::shared_ptr<const KnapsackProblem> t_problem)
+	{
+		sharedProblem() = t_problem ? t_problem : std::make_shared<KnapsackProblem>();
+	}
+
+	const KnapsackProblem& ChromoLargeKnapsack::getProblem()
+	{
+		return *sharedProblem();
+	}
+
+	bool ChromoLargeKnapsack::hasItem(const std::size_t t_item) const
+	{
+		return ((static_cast<unsigned char>(m_encoded[t_item / 8]) >> (t_item % 8)) & 1) != 0;
+	}
+
+	/**
+	*	@brief  Adds an item to the bag, or takes it out.
+	*
+	*	@param  t_item specifies the item
+	*	@param  t_isTaken specifies whether the item is in the bag
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::setItem(const std::size_t t_item, const bool t_isTaken)
+	{
+		const char bit{ static_cast<char>(1 << (t_item % 8)) };
+		if (t_isTaken) {
+			m_encoded[t_item / 8] |= bit;
+		}
+		else {
+			m_encoded[t_item / 8] &= ~bit;
+		}
+		markScoreStale();
+	}
+
+	/**
+	*	@brief  Counts the items in the bag.
+	*
+	*	@return number of items taken
+	*/
+	std::size_t ChromoLargeKnapsack::countItems() const
+	{
+		std::size_t count{ 0 };
+		for (std::size_t i{ 0 }; i < m_encoded.length(); ++i)
+		{
+			unsigned char byte{ static_cast<unsigned char>(m_encoded[i]) };
+			for (; byte != 0; byte &= byte - 1) {
+				++count;
+			}
+		}
+		return count;
+	}
+
+	/**
+	*	@brief  This is an operator overload that allows the chromosome to be printed.
+	*	Only the number of items is printed, as there may be many.
+	*
+	*	@param  t_output is the output stream
+	*   @param  self is the reference to this Chromo
+	*	@return Output stream
+	*/
+	std::ostream& operator<<(std::ostream& t_output, const ChromoLargeKnapsack& self) {
+		t_output << self.countItems() << " of " << ChromoLargeKnapsack::getProblem().getItemCount() << " items";
+		t_output << "\t Score = " << self.getScore();
+		return t_output;
+	}
+
+	/**
+	*	@brief  This is a static function used by GeneticAlgorithm.h to obtain the data partitions within the encoded chromosome.
+	*	Each partition holds 64 items (one 64-bit word of the selection), so a
+	*	change only keeps and rescores the words it touched. Each CSV column
+	*	is named by the first item of its partition and the offset within it:
+	*	Items64+3 is item 67.
+	*
+	*	@param  t_encodedPartitions specifies the vector of partitions to be modified
+	*   @param  t_mutationLimits specifies the bytes and partitions allowed for the crossover and mutation phases
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::getEncodedPartitions(std::vector<EncodedPartition>& t_encodedPartitions, MutationLimits& t_mutationLimits)
+	{
+		t_encodedPartitions.clear();
+		std::size_t location{ 0 };
+		t_mutationLimits.bytes = 0;
+		t_mutationLimits.partitions = 0;
+
+		const std::size_t itemCount{ getProblem().getItemCount() };
+		if (itemCount == 0) {
+			std::cout << "\nERROR: No knapsack items. Call ChromoLargeKnapsack::setProblem() before creating the GA.\n\n";
+			return;
+		}
+		t_encodedPartitions.reserve((itemCount + 63) / 64);
+		for (std::size_t firstItem{ 0 }; firstItem < itemCount; firstItem += 64) {
+			Chromo::addItemIndicesOfBoolVector(t_encodedPartitions, t_mutationLimits, location, std::min<std::size_t>(64, itemCount - firstItem),
+				"Items" + std::to_string(firstItem) + "+", true);
+		}
+	}
+
+	/**
+	*	@brief  Runs the fitness function for this chromosome. This operates locally and does not affect other chromosomes that are being tested.
+	*	The selection is scored straight from the encoded data (see KnapsackProblem::scoreTotals()).
+	*	Its totals are kept in m_fitnessTerms for updateFitness().
+	*
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::runFitnessFunctionLocal()
+	{
+		const KnapsackProblem& problem{ getProblem() };
+		if (m_encoded.length() < problem.getSelectionBytes()) {
+			m_fitnessTerms.clear();
+			Chromo::setScore(0);
+			return;
+		}
+
+		std::int64_t* totals{ problem.getTotalsBuffer() };
+		problem.sumTotals(reinterpret_cast<const unsigned char*>(m_encoded.data()), totals);
+		m_fitnessTerms.assign(totals, totals + 1 + problem.getDimensionCount());
+		Chromo::setScore(problem.scoreTotals(totals));
+	}
+
+	/**
+	*	@brief  Updates the score from the items added or taken out since it was set.
+	*	Each changed partition is one 64-bit word of the selection, and only
+	*	those words are summed, so the cost depends on the number of changes.
+	*
+	*	@param  t_previousScore specifies the score before the changes
+	*	@param  t_changedPartitions specifies what changed, and the previous data
+	*	@return true if the score was updated, false to run the full fitness function
+	*/
+	bool ChromoLargeKnapsack::updateFitness(const double t_previousScore, const ChangedPartitions& t_changedPartitions)
+	{
+		const KnapsackProblem& problem{ getProblem() };
+		if (m_fitnessTerms.size() != 1 + problem.getDimensionCount() || m_encoded.length() < problem.getSelectionBytes()) {
+			return false;
+		}
+		if (t_changedPartitions.isEmpty()) {
+			Chromo::setScore(t_previousScore);
+			return true;
+		}
+
+		// Totals are whole numbers, well within the exact range of a double
+		std::int64_t* totals{ problem.getTotalsBuffer() };
+		for (std::size_t i{ 0 }; i < m_fitnessTerms.size(); ++i) {
+			totals[i] = static_cast<std::int64_t>(m_fitnessTerms[i]);
+		}
+		const unsigned char* previousSelection{ reinterpret_cast<const unsigned char*>(t_changedPartitions.getPreviousData()) };
+		const unsigned char* selection{ reinterpret_cast<const unsigned char*>(m_encoded.data()) };
+		for (std::size_t p{ t_changedPartitions.findNext(0) }; p != ChangedPartitions::npos; p = t_changedPartitions.findNext(p + 1))
+		{
+			const EncodedPartition& partition{ t_changedPartitions.getPartition(p) };
+			problem.updateTotals(previousSelection, selection, totals, partition.location, partition.location + partition.bytes);
+		}
+		for (std::size_t i{ 0 }; i < m_fitnessTerms.size(); ++i) {
+			m_fitnessTerms[i] = static_cast<double>(totals[i]);
+		}
+		Chromo::setScore(problem.scoreTotals(totals));
+		return true;
+	}
+
+	/**
+	*	@brief  Performs custom mutations on data values
+	*	These data values should be part of the encoded string,
+	*	yet not used in the crossover and mutation phases.
+	*
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::mutateCustom()
+	{
+		// No custom mutations required!
+	}
+
+	/**
+	*	@brief  The items are stored in the encoded data, so this only checks its size.
+	*
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::encode()
+	{
+		m_encoded.resize(getProblem().getSelectionBytes());
+	}
+
+	/**
+	*	@brief  The items are read straight from the encoded data, so this only checks its size.
+	*
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::decode()
+	{
+		if (m_encoded.length() < getProblem().getSelectionBytes()) {
+			std::cout << "\nERROR: Encoded data is shorter than the number of knapsack items.\n\n";
+		}
+	}
+
+	/**
+	*	@brief  Clears the unused bits of the last byte, so equal selections always have equal encodings.
+	*
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::applyLimits()
+	{
+		const std::size_t itemCount{ getProblem().getItemCount() };
+		if (itemCount % 8 != 0 && m_encoded.length() == getProblem().getSelectionBytes()) {
+			m_encoded[itemCount / 8] &= static_cast<char>((1 << (itemCount % 8)) - 1);
+		}
+	}
+
+	/**
+	*	@brief  Writes each item as T or F to a stream.
+	*
+	*	@param  t_oStream specifies the stream, after the ID and score
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::writeDataToCSV(std::ostream& t_oStream)
+	{
+		writeBufferedDataToCSV(t_oStream);
+	}
+
+	/**
+	*	@brief  Writes each item straight into a CSV line, as T or F.
+	*
+	*	@param  t_buffer specifies the line, after the ID and score
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::writeDataToCSV(bif::CSVBuffer& t_buffer)
+	{
+		const std::size_t itemCount{ getProblem().getItemCount() };
+		t_buffer.reserve(t_buffer.size() + itemCount * 2);
+		for (std::size_t i{ 0 }; i < itemCount; ++i) {
+			t_buffer.writeBool(hasItem(i));
+		}
+	}
+
+	/**
+	*	@brief  Reads each item from a CSV line.
+	*
+	*	@param  t_chromoValues is a vector of strings containing the CSV row values
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::readDataFromCSV(std::vector<std::string>& t_chromoValues)
+	{
+		encode();
+		const std::size_t itemCount{ std::min(getProblem().getItemCount(), t_chromoValues.size()) };
+		for (std::size_t i{ 0 }; i < itemCount; ++i) {
+			setItem(i, t_chromoValues[i] == "T");
+		}
+	}
+
+	/**
+	*	@brief  Reads each item straight from a CSV line, without splitting it into strings.
+	*
+	*	@param  t_cursor specifies the line, positioned at the first item
+	*	@return void
+	*/
+	void ChromoLargeKnapsack::readDataFromCSV(bif::CSVCursor& t_cursor)
+	{
+		encode();
+		const std::size_t itemCount{ getProblem().getItemCount() };
+		for (std::size_t i{ 0 }; i < itemCount; ++i)
+		{
+			bool isTaken;
+			t_cursor.readBool(isTaken);
+			setItem(i, isTaken);
+		}
+	}
+
+} // namespace ga
@@ -0,0 +1,98 @@
+/**
+* @class ChromoLargeKnapsack.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Attempts to fill a "bag" from a large set of items loaded at run time, maximizing their value within every weight limit
+*
+* The items are held by a KnapsackProblem (see KnapsackProblem.h), which
+* is shared by every Chromo and must be set before the GeneticAlgorithm
+* is created:
+*
+*	auto problem = std::make_shared<ga::KnapsackProblem>();
+*	problem->loadFromCSV("items.csv", "value", { "weight" }, { 5000 });
+*	ga::ChromoLargeKnapsack::setProblem(problem);
+*	ga::GeneticAlgorithm<ga::ChromoLargeKnapsack> ga1(...);
+*
+* The encoded data is the selection itself, one bit per item, so there is
+* nothing to encode or decode, and 100,000 items take 12,500 bytes.
+*
+* Each partition holds 64 items. The total value and weights are kept with
+* the score, so after a mutation or crossover only the partitions that
+* changed are summed again (see updateFitness()).
+*
+* @see (link to GitHub)
+*/
+
+#ifndef CHROMO_LARGE_KNAPSACK_H_
+#define CHROMO_LARGE_KNAPSACK_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <memory>
+#include <cstdint>
+
+#include "Chromo.h"
+#include "KnapsackProblem.h"
+
+namespace ga
+{
+	class ChromoLargeKnapsack : public Chromo
+	{
+	public:
+		explicit ChromoLargeKnapsack(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
+			: Chromo(t_initialStateId, t_randomGenerator)
+		{
+			initializeValues(t_initialStateId);
+		};
+		~ChromoLargeKnapsack() {};
+
+		void initializeValues(const int);
+
+		// Items shared by every Chromo
+		static void setProblem(const std::shared_ptr<const KnapsackProblem>);
+		static const KnapsackProblem& getProblem();
+
+		// Whether each item is in the bag
+		bool hasItem(const std::size_t) const;
+		void setItem(const std::size_t, const bool);
+		std::size_t countItems() const;
+
+		// Run the fitness function on only this chromosome,
+		// rather than in a larger simulation
+		void runFitnessFunctionLocal();
+		// Update the previous score from only the items that changed
+		static bool hasFitnessUpdate() { return true; };
+		bool updateFitness(const double, const ChangedPartitions&);
+
+		// Custom mutations for certain data
+		// Most commonly adding/subtracting by random amount rather than flipping bits
+		// Floats/doubles are often easier to mutate this way
+		void mutateCustom();
+		static bool hasCustomMutations() { return false; };
+
+		// Data processing that enables
+		// crossover and mutation phases,
+		// as well as file I/O
+		void encode();
+		void decode();
+		void applyLimits();
+
+		// Extra info to be used during crossovers and mutations
+		static void getEncodedPartitions(std::vector<EncodedPartition>&, MutationLimits&);
+
+		// Custom output
+		friend std::ostream& operator<<(std::ostream&, const ChromoLargeKnapsack&);
+
+	protected:
+		// Input/output
+		void writeDataToCSV(std::ostream&);
+		void writeDataToCSV(bif::CSVBuffer&);
+		void readDataFromCSV(std::vector<std::string>&);
+		void readDataFromCSV(bif::CSVCursor&);
+	};
+
+} // namespace ga
+
+#endif	// CHROMO_LARGE_KNAPSACK_H_
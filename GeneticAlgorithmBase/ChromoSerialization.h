@@ -22,11 +22,32 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 
 #include "GeneticAlgorithmTechniques.h"
+#include "RandomGenerator.h"
+#include "CrossoverKernels.h"
+#include "ChangedPartitions.h"
 
 namespace ga
 {
+	/**
+	*	@brief  Adds the encoded value to the end of existing encoded data.
+	*	Unlike encodePrimitive(), no temporary string is created, so this
+	*	does not allocate once the encoded data has reached its full size.
+	*
+	*	@param  t_encoded is the encoded data to add to (std::string or EncodedData)
+	*	@param  t_data specifies the value to be converted
+	*	@return void
+	*/
+	template <typename E, typename T>
+	static void appendEncodedPrimitive(E& t_encoded, const T t_data)
+	{
+		t_encoded.append(reinterpret_cast<const char*>(&t_data), sizeof(T));
+	}
+
 	/**
 	*	@brief  Takes in a value and returns a short string containing the encoded value
 	*	The length of the string is the number of bytes in the primitive
@@ -38,16 +59,7 @@ namespace ga
 	static std::string encodePrimitive(T t_data)
 	{
 		std::string encoded = "";
-		encoded.reserve(sizeof(T) + 1);
-
-		T* pointerToData = &t_data;
-		char *charPointer = reinterpret_cast<char*>(pointerToData);
-		for (std::size_t i{ 0 }; i < sizeof(T); ++i)
-		{
-			char ch = *charPointer;
-			encoded += ch;
-			charPointer++;
-		}
+		appendEncodedPrimitive(encoded, t_data);
 		return encoded;
 	}
 
@@ -55,24 +67,39 @@ namespace ga
 	*	@brief  Modifies a primitive to be the value of an encoded string
 	*
 	*	@param  t_data specifies the value to be modified
-	*   @param  t_encoded is the encoded value
+	*   @param  t_encoded is the encoded value (std::string or EncodedData)
 	*	@return void
 	*/
-	template <typename T>
-	static std::size_t decodePrimitive(T& t_data, std::string& t_encoded)
+	template <typename T, typename E>
+	static std::size_t decodePrimitive(T& t_data, E& t_encoded)
 	{
-		// First, convert to a character array
-		char* encodedChars = new char[sizeof(T)];
-		for (std::size_t i{ 0 }; i < sizeof(T); ++i) {
-			encodedChars[i] = t_encoded.at(i);
+		if (t_encoded.length() < sizeof(T)) {
+			std::cout << "\nERROR: Encoded data is too short to decode value.\n\n";
+			return sizeof(T);
 		}
 
-		T number = *((T*)encodedChars);
-		t_data = number;
-		free(encodedChars);
+		// Copy straight into the value, which also avoids unaligned reads
+		std::memcpy(&t_data, t_encoded.data(), sizeof(T));
 		return sizeof(T);
 	}
 
+	/**
+	*	@brief  Adds the encoded vector to the end of existing encoded data.
+	*	Unlike encodeVector(), no temporary string is created, so this
+	*	does not allocate once the encoded data has reached its full size.
+	*
+	*	@param  t_encoded is the encoded data to add to (std::string or EncodedData)
+	*	@param  t_vec specifies the vector to be converted
+	*	@return void
+	*/
+	template <typename E, typename T>
+	static void appendEncodedVector(E& t_encoded, const std::vector<T>& t_vec)
+	{
+		if (!t_vec.empty()) {
+			t_encoded.append(reinterpret_cast<const char*>(t_vec.data()), sizeof(T) * t_vec.size());
+		}
+	}
+
 	/**
 	*	@brief  Takes in a vector and returns a short string containing the encoded vector
 	*	The length of the string is the number of bytes in the primitive multiplied by the size of the vector
@@ -84,21 +111,8 @@ namespace ga
 	static std::string encodeVector(std::vector<T>& t_vec)
 	{
 		std::string encodedVector = "";
-		const std::size_t n{ t_vec.size() };
-		encodedVector.reserve(sizeof(T) * n + 1);
-
-		for (std::size_t i{ 0 }; i < n; ++i)
-		{
-			T* pointerToData = &t_vec.at(i);
-			char *charPointer = reinterpret_cast<char*>(pointerToData);
-			for (std::size_t ii = 0; ii < sizeof(T); ++ii)
-			{
-				char ch = *charPointer;
-				encodedVector += ch;
-				charPointer++;
-			}
-		}
-
+		encodedVector.reserve(sizeof(T) * t_vec.size() + 1);
+		appendEncodedVector(encodedVector, t_vec);
 		return encodedVector;
 	}
 
@@ -106,58 +120,47 @@ namespace ga
 	*	@brief  Modifies a vector to pull values from a encoded string
 	*
 	*	@param  t_vec specifies the vector to be modified
-	*   @param  t_encoded is the encoded value
+	*   @param  t_encoded is the encoded value (std::string or EncodedData)
 	*   @param  t_strFirstIndex is the location where the vector data begins
 	*	@return std::size_t indicating where the next data in the encoded string is location
 	*/
-	template <typename T>
-	static std::size_t decodeVector(std::vector<T>& t_vec, const std::string& t_encoded, const std::size_t t_strFirstIndex)
+	template <typename T, typename E>
+	static std::size_t decodeVector(std::vector<T>& t_vec, const E& t_encoded, const std::size_t t_strFirstIndex)
 	{
-		// Character buffer for each value
-		char* buffer = new char[sizeof(T)];
-
-		// Iterate through each item
-		const std::size_t n { t_vec.size() };
-		for (std::size_t i{ 0 }; i < n; ++i)
-		{
-			// Items can be contained within multiple characters
-			// So we iterate through each character
-			for (std::size_t ii{ 0 }; ii < sizeof(T); ++ii) {
-				buffer[ii] = t_encoded.at(t_strFirstIndex + i * sizeof(T) + ii);
-			}
-
-			// Get value from buffer
-			T number = *((T*)buffer);
-			t_vec.at(i) = number;
+		const std::size_t bytes{ sizeof(T) * t_vec.size() };
+		if (t_strFirstIndex + bytes > t_encoded.length()) {
+			std::cout << "\nERROR: Encoded data is too short to decode vector.\n\n";
+		}
+		else if (bytes > 0) {
+			// Copy every item at once
+			std::memcpy(t_vec.data(), t_encoded.data() + t_strFirstIndex, bytes);
 		}
-
-		// Cleanup
-		free(buffer);
 
 		// Return final index so that more data can be read
-		return (t_strFirstIndex + sizeof(T) * t_vec.size());
+		return (t_strFirstIndex + bytes);
 	}
 
 	/**
-	*	@brief  Takes in a bool vector and returns a short string containing the encoded vector
+	*	@brief  Adds the encoded bool vector to the end of existing encoded data.
+	*	Unlike encodeBoolVector(), no temporary string is created, so this
+	*	does not allocate once the encoded data has reached its full size.
 	*
-	*	@param  t_vec specifies the value to be converted
-	*	@return string containing the encoded vector
+	*	@param  t_encoded is the encoded data to add to (std::string or EncodedData)
+	*	@param  t_vec specifies the vector to be converted
+	*	@return void
 	*/
-	static std::string encodeBoolVector(std::vector<bool>& t_vec)
+	template <typename E>
+	static void appendEncodedBoolVector(E& t_encoded, const std::vector<bool>& t_vec)
 	{
 		const std::size_t n{ t_vec.size() };
-		std::string encodedVector = "";
-		encodedVector.reserve(n / 8 + 2);
 		
-		std::size_t byteId{ 0 };
 		std::size_t bitId{ 0 };
 		char curChar{ 0x00 };
 		for (std::size_t i{ 0 }; i < n; ++i)
 		{
 			// Byte defaults to 00000000
 			// Set bit if boolean == True
-			if (t_vec.at(i)) {
+			if (t_vec[i]) {
 				curChar |= (1 << bitId);
 			}
 			
@@ -165,15 +168,27 @@ namespace ga
 			++bitId;
 			if (bitId >= 8) {
 				bitId = 0;
-				encodedVector += curChar;
-				++byteId;
+				t_encoded += curChar;
+				curChar = 0x00;
 			}
 		}
 		// If we were in the middle of a byte, write it to the string
 		if (bitId > 0) {
-			encodedVector += curChar;
+			t_encoded += curChar;
 		}
+	}
 
+	/**
+	*	@brief  Takes in a bool vector and returns a short string containing the encoded vector
+	*
+	*	@param  t_vec specifies the value to be converted
+	*	@return string containing the encoded vector
+	*/
+	inline std::string encodeBoolVector(std::vector<bool>& t_vec)
+	{
+		std::string encodedVector = "";
+		encodedVector.reserve(t_vec.size() / 8 + 2);
+		appendEncodedBoolVector(encodedVector, t_vec);
 		return encodedVector;
 	}
 
@@ -181,11 +196,12 @@ namespace ga
 	*	@brief  Modifies a bool vector to pull values from an encoded string
 	*
 	*	@param  t_vec specifies the vector to be modified
-	*   @param  t_encoded is the encoded value
+	*   @param  t_encoded is the encoded value (std::string or EncodedData)
 	*   @param  t_strFirstIndex is the location where the vector data begins
 	*	@return std::size_t indicating where the next data in the encoded string is location
 	*/
-	static std::size_t decodeBoolVector(std::vector<bool>& t_vec, std::string& t_encoded, const std::size_t t_strFirstIndex)
+	template <typename E>
+	static std::size_t decodeBoolVector(std::vector<bool>& t_vec, E& t_encoded, const std::size_t t_strFirstIndex)
 	{
 		std::size_t bytesUsed;
 		if (t_vec.size() % 8 == 0) {
@@ -215,87 +231,236 @@ namespace ga
 	}
 
 	/**
-	*	@brief  Returns a string containing shuffled bytes from two source strings
-	*	This is used during the crossover phase of the GA
+	*	@brief  Fills a result with shuffled bytes (or bits) from two sources of the same length
+	*	This is used during the crossover phase of the GA.
+	*	The result is written in place, so it can be a slot in a PopulationBuffer.
 	*
-	*	@param  t_source1 specifies the 1st source string
-	*	@param  t_source2 specifies the 2nd source string
+	*	Random masks are built a block at a time, then the sources are
+	*	blended through the mask with SIMD instructions (see CrossoverKernels.h).
+	*	In byte mode, each random bit chooses a whole byte. In bit mode,
+	*	every bit is chosen separately.
+	*
+	*	@param  t_source1 specifies the 1st source (std::string or EncodedData)
+	*	@param  t_source2 specifies the 2nd source
+	*	@param  t_result is resized to the source length and overwritten
 	*   @param  t_randomGenerator is the random number generator to use
-	*	@return a shuffled string
+	*	@param  t_shuffleMode specifies whether to choose bytes or bits (ShuffleMode::byte or ShuffleMode::bit)
+	*	@return void
 	*/
-	static std::string shuffleEncodedData(std::string const& t_source1, std::string const& t_source2, int(*t_randomGenerator)(void))
+	template <typename E>
+	static void shuffleEncodedData(const E& t_source1, const E& t_source2, E& t_result, RandomGenerator& t_randomGenerator,
+		const ShuffleMode t_shuffleMode = ShuffleMode::byte)
 	{
 		if (t_source1.length() != t_source2.length())
 		{
 			// Error: One of parents was not encoded correctly
 			std::cout << "\nENCODING ERROR!\n";
-			return "";
+			t_result.clear();
+			return;
 		}
 
 		const std::size_t n{ t_source1.length() };
-		std::string shuffledString = "";
-		shuffledString.reserve(n);
+		t_result.resize(n);
+		if (n == 0) {
+			return;
+		}
 
-		for (std::size_t i{ 0 }; i < n; ++i)
+		const char* source1{ t_source1.data() };
+		const char* source2{ t_source2.data() };
+		char* result{ &t_result[0] };
+
+		// Must be a multiple of 64, so each byte mask block uses whole draws
+		const std::size_t blockSize{ 256 };
+		unsigned char mask[blockSize];
+		for (std::size_t first{ 0 }; first < n; first += blockSize)
 		{
-			if (t_randomGenerator() % 2) {
-				shuffledString += t_source1.at(i);
+			const std::size_t bytes{ n - first < blockSize ? n - first : blockSize };
+
+			if (t_shuffleMode == ShuffleMode::bit) {
+				t_randomGenerator.fillRandomBits(mask, bytes);
 			}
 			else {
-				shuffledString += t_source2.at(i);
+				// Draw 64 coin flips at a time rather than one per byte
+				for (std::size_t i{ 0 }; i < bytes; i += 64) {
+					expandBitsToByteMask(t_randomGenerator.nextU64(), mask + i);
+				}
 			}
 
+			blendEncodedBytes(source1 + first, source2 + first, mask, result + first, bytes);
 		}
-
-		return shuffledString;
 	}
 
 	/**
-	*	@brief  Returns a string containing bytes from two source strings, split into n-partitions
+	*	@brief  Returns a string containing shuffled bytes from two source strings
 	*	This is used during the crossover phase of the GA
 	*
 	*	@param  t_source1 specifies the 1st source string
 	*	@param  t_source2 specifies the 2nd source string
-	*	@param  t_splits specifies the number of times to alternate between source strings
 	*   @param  t_randomGenerator is the random number generator to use
 	*	@return a shuffled string
 	*/
-	static std::string nSplitEncodedData(std::string const& t_source1, std::string const& t_source2, std::size_t t_splits, int(*t_randomGenerator)(void))
+	inline std::string shuffleEncodedData(std::string const& t_source1, std::string const& t_source2, RandomGenerator& t_randomGenerator)
+	{
+		std::string shuffledString;
+		shuffleEncodedData(t_source1, t_source2, shuffledString, t_randomGenerator);
+		return shuffledString;
+	}
+
+	/**
+	*	@brief  Fills a result with bytes from two sources of the same length, split into (n + 1) partitions
+	*	This is used during the crossover phase of the GA.
+	*	Split locations are sampled in O(n log n) time, regardless of
+	*	the length of the data. Each partition is then copied from
+	*	alternating sources with memcpy, directly into the result.
+	*
+	*	@param  t_source1 specifies the 1st source (std::string or EncodedData)
+	*	@param  t_source2 specifies the 2nd source
+	*	@param  t_result is resized to the source length and overwritten
+	*	@param  t_splits specifies the number of times to alternate between sources. Limited to (length - 1).
+	*   @param  t_randomGenerator is the random number generator to use
+	*	@return void
+	*/
+	template <typename E>
+	static void nSplitEncodedData(const E& t_source1, const E& t_source2, E& t_result, std::size_t t_splits, RandomGenerator& t_randomGenerator)
 	{
 		if (t_source1.length() != t_source2.length())
 		{
 			// Error: One of parents was not encoded correctly
 			std::cout << "\nENCODING ERROR!\n";
-			return "";
+			t_result.clear();
+			return;
 		}
-		std::string result = "";
-		result.reserve(t_source1.length());
 
-		// Split locations refer to the beginning of each partition
-		// The first location is always set to be 0
-		std::vector<std::size_t> splitLocations{0};
-		std::size_t size1{ 1 };
-		getUniqueRandomNumbers(splitLocations, t_splits - size1, size1, t_source1.length() - size1, t_randomGenerator);
+		const std::size_t length{ t_source1.length() };
+		t_result.resize(length);
+		if (length == 0) {
+			return;
+		}
+
+		// Split locations are where each partition after the first begins,
+		// anywhere in [1, length)
+		// Each thread reuses its own vector, so this only allocates
+		// until the vector has grown to fit the number of splits
+		static thread_local std::vector<std::size_t> splitLocations;
+		getSortedUniqueRandomNumbers(splitLocations, t_splits, static_cast<std::size_t>(1), length, t_randomGenerator);
 
-		short int useStringNow{ t_randomGenerator() % 2 };
+		bool useSource1{ (t_randomGenerator.nextU64() & 1) != 0 };
+		char* result{ &t_result[0] };
 		std::size_t locationNow{ 0 };
 		const std::size_t n{ splitLocations.size() };
-		for (std::size_t i{ 0 }; i < n; ++i)
+		for (std::size_t i{ 0 }; i <= n; ++i)
 		{
-			std::size_t partitionSize { (i != n - size1) ? splitLocations.at(i + size1) - i : t_source1.length() - i };
-			result += useStringNow ? t_source1.substr(locationNow, partitionSize) : t_source2.substr(locationNow, partitionSize);
+			const std::size_t locationNext{ i < n ? splitLocations[i] : length };
+			std::memcpy(result + locationNow, (useSource1 ? t_source1.data() : t_source2.data()) + locationNow, locationNext - locationNow);
 
-			useStringNow = (useStringNow + 1) % 2;
-			locationNow += partitionSize;
+			locationNow = locationNext;
+			useSource1 = !useSource1;
 		}
+	}
 
+	/**
+	*	@brief  Returns a string containing bytes from two source strings, split into n-partitions
+	*	This is used during the crossover phase of the GA
+	*
+	*	@param  t_source1 specifies the 1st source string
+	*	@param  t_source2 specifies the 2nd source string
+	*	@param  t_splits specifies the number of times to alternate between source strings
+	*   @param  t_randomGenerator is the random number generator to use
+	*	@return a shuffled string
+	*/
+	inline std::string nSplitEncodedData(std::string const& t_source1, std::string const& t_source2, std::size_t t_splits, RandomGenerator& t_randomGenerator)
+	{
+		std::string result;
+		nSplitEncodedData(t_source1, t_source2, result, t_splits, t_randomGenerator);
 		return result;
 	}
 
-	static void mutateRandomBits(std::string& t_encoded, std::vector<EncodedPartition>& t_encodedPartitions, const MutationLimits t_mutationLimits,
+	/**
+	*	@brief  Toggles bits in the range [t_firstBit, t_endBit), each with the same chance.
+	*	Instead of rolling for every bit, the distance to the next toggled bit
+	*	is drawn from a geometric distribution, so the cost grows with the
+	*	number of bits toggled rather than the size of the range.
+	*	Toggles are gathered into a 64-bit mask and applied one word at a time.
+	*	Bit i is bit (i % 8) of byte (i / 8).
+	*
+	*	@param  t_encoded is the encoded data to modify (std::string or EncodedData)
+	*	@param  t_firstBit specifies the first bit that may be toggled
+	*	@param  t_endBit specifies the bit after the last one that may be toggled
+	*	@param  t_chance specifies the chance of each bit being toggled, in [0, 1]
+	*   @param  t_randomGenerator is the random number generator to use
+	*	@return void
+	*/
+	template <typename E>
+	static void toggleRandomBits(E& t_encoded, const std::size_t t_firstBit, const std::size_t t_endBit,
+		const double t_chance, RandomGenerator& t_randomGenerator)
+	{
+		if (t_chance <= 0.0 || t_firstBit >= t_endBit) {
+			return;
+		}
+
+		unsigned char* data{ reinterpret_cast<unsigned char*>(&t_encoded.begin()[0]) };
+		const std::size_t endByte{ (t_endBit + 7) / 8 };
+		const bool isEveryBit{ t_chance >= 1.0 };
+		const double logFailChance{ isEveryBit ? 0.0 : std::log1p(-t_chance) };
+
+		std::size_t wordId{ t_firstBit / 64 };
+		std::uint64_t mask{ 0 };
+		// XORs the mask into the current word, without touching bytes past endByte
+		auto applyMask = [&]() {
+			const std::size_t byteId{ wordId * 8 };
+			const std::size_t bytes{ endByte - byteId < 8 ? endByte - byteId : 8 };
+			std::uint64_t word{ 0 };
+			std::memcpy(&word, data + byteId, bytes);
+			word ^= mask;
+			std::memcpy(data + byteId, &word, bytes);
+		};
+
+		std::size_t bitId{ t_firstBit };
+		while (true)
+		{
+			if (!isEveryBit) {
+				// Skip the bits that are not toggled
+				const double skip{ t_randomGenerator.nextGeometric(logFailChance) };
+				if (skip >= static_cast<double>(t_endBit - bitId)) {
+					break;
+				}
+				bitId += static_cast<std::size_t>(skip);
+			}
+			else if (bitId >= t_endBit) {
+				break;
+			}
+
+			if (bitId / 64 != wordId) {
+				if (mask != 0) {
+					applyMask();
+				}
+				wordId = bitId / 64;
+				mask = 0;
+			}
+			mask |= static_cast<std::uint64_t>(1) << (bitId % 64);
+			++bitId;
+		}
+		if (mask != 0) {
+			applyMask();
+		}
+	}
+
+	/**
+	*	@brief  Applies mutations to encoded data, according to the GA's mutation settings.
+	*
+	*	@param  t_mutationCount specifies the number of mutation blocks
+	*	@param  t_mutationBitWidth specifies the number of bits in each mutation block
+	*	@param  t_mutationChance specifies the chance of each bit within a block being toggled, in [0, 1]
+	*   @param  t_randomGenerator is the random number generator to use
+	*	@param  t_changedPartitions records the partitions covered by the mutation blocks, if not nullptr
+	*	@return Number of encoded bytes covered by the mutation blocks
+	*/
+	template <typename E>
+	static std::size_t mutateRandomBits(E& t_encoded, std::vector<EncodedPartition>& t_encodedPartitions, const MutationLimits t_mutationLimits,
 		const MutationSelection t_mutationSelection, const std::size_t t_mutationCount, const std::size_t t_mutationBitWidth,
-		const short int t_mutationChanceIn100, int(*t_randomGenerator)(void))
+		const double t_mutationChance, RandomGenerator& t_randomGenerator, ChangedPartitions* t_changedPartitions = nullptr)
 	{
+		std::size_t mutatedBytes{ 0 };
 		for (std::size_t nMutate{ 0 }; nMutate < t_mutationCount; ++nMutate)
 		{
 			// Select start location and range for mutation
@@ -303,6 +468,7 @@ namespace ga
 			short int bitId{ 0 };
 			std::size_t bitsLeft{ t_mutationBitWidth };
 			EncodedPartitionType partitionType{ EncodedPartitionType::normal };
+			std::size_t uniqueBits{ 0 };
 			
 			// Apply MutationSelection settings
 			if (t_mutationSelection == MutationSelection::entirePartition) {
@@ -311,6 +477,7 @@ namespace ga
 				byteId = t_encodedPartitions.at(partitionId).location;
 				bitsLeft = t_encodedPartitions.at(partitionId).bytes * 8;
 				partitionType = t_encodedPartitions.at(partitionId).type;
+				uniqueBits = t_encodedPartitions.at(partitionId).uniqueBits;
 			}
 			else if (t_mutationSelection == MutationSelection::pureRandom) {
 				byteId = t_randomGenerator() % t_mutationLimits.bytes;
@@ -322,40 +489,16 @@ namespace ga
 
 			if (partitionType == EncodedPartitionType::normal)
 			{
-				// Modify sequence of bits, up to t_mutationWidth
-				char byte{ t_encoded.begin()[byteId] };
-				while (bitsLeft > 0)
-				{
-					// Random selection for bits to toggle
-					if (t_randomGenerator() % 100 < t_mutationChanceIn100) {
-						// Toggle bit
-						byte ^= (1 << bitId);
-					}
-
-					// Advance to next bit
-					++bitId;
-					// Advance to next byte
-					if (bitId >= 8) {
-						// Return mutated byte
-						t_encoded.begin()[byteId] = byte;
-
-						// Move to next byte, if possible
-						if (byteId + 1 < t_mutationLimits.bytes) {
-							bitId -= 8;
-							++byteId;
-
-							byte = t_encoded.begin()[byteId];
-						}
-						else {
-							// Exit loop because there are no more possible bits to modify
-							break;
-						}
-					}
-
-					--bitsLeft;
+				// Modify sequence of bits, up to t_mutationBitWidth,
+				// without going past the mutable bytes
+				const std::size_t firstBit{ byteId * 8 + bitId };
+				const std::size_t limitBit{ t_mutationLimits.bytes * 8 };
+				const std::size_t endBit{ bitsLeft < limitBit - firstBit ? firstBit + bitsLeft : limitBit };
+				if (t_changedPartitions) {
+					t_changedPartitions->markBytes(firstBit / 8, (endBit + 7) / 8, &t_encoded.begin()[0], t_encoded.length());
 				}
-				// Return mutated byte
-				t_encoded.begin()[byteId] = byte;
+				toggleRandomBits(t_encoded, firstBit, endBit, t_mutationChance, t_randomGenerator);
+				mutatedBytes += (endBit + 7) / 8 - firstBit / 8;
 			}
 			else if (partitionType == EncodedPartitionType::eachBitUnique)
 			{
@@ -365,18 +508,64 @@ namespace ga
 
 				// Boolean partitions contain many booleans,
 				// so we select only one random bit and modify it
-				std::size_t selectByte{ byteId + t_randomGenerator() % (bitsLeft / 8) };
-				std::size_t selectBit{ t_randomGenerator() % static_cast<std::size_t>(8) };
+				// Padding bits past the last boolean are never selected
+				const std::size_t partitionBits{ uniqueBits != 0 ? uniqueBits : bitsLeft };
+				const std::size_t selectedBit{ t_randomGenerator.nextIndex(partitionBits) };
+				const std::size_t selectByte{ byteId + selectedBit / 8 };
 
 				// Toggle random bit
-				selectByte = byteId;
+				if (t_changedPartitions) {
+					t_changedPartitions->markBytes(selectByte, selectByte + 1, &t_encoded.begin()[0], t_encoded.length());
+				}
 				char byte{ t_encoded.begin()[selectByte] };
-				byte ^= (1 << selectBit);
+				byte ^= (1 << (selectedBit % 8));
 
 				// Return mutated byte
 				t_encoded.begin()[selectByte] = byte;
+				++mutatedBytes;
 			}
 		}
+		return mutatedBytes;
+	}
+
+	/**
+	*	@brief  Returns a 64-bit hash of encoded data.
+	*	Reads 8 bytes at a time, so long strings hash quickly.
+	*	This is not a cryptographic hash.
+	*
+	*	@param  t_data points to the encoded data
+	*	@param  t_length specifies the number of bytes
+	*	@return hash of the data
+	*/
+	inline std::uint64_t hashEncodedData(const char* t_data, const std::size_t t_length)
+	{
+		const std::uint64_t multiplier1{ 0x87C37B91114253D5ULL };
+		const std::uint64_t multiplier2{ 0x4CF5AD432745937FULL };
+		std::uint64_t hash{ 0x9E3779B97F4A7C15ULL ^ (static_cast<std::uint64_t>(t_length) * multiplier2) };
+
+		std::size_t i{ 0 };
+		while (i < t_length)
+		{
+			// The last word is padded with zeros
+			std::uint64_t word{ 0 };
+			const std::size_t bytes{ t_length - i < 8 ? t_length - i : 8 };
+			std::memcpy(&word, t_data + i, bytes);
+			i += bytes;
+
+			word *= multiplier1;
+			word = (word << 31) | (word >> 33);
+			word *= multiplier2;
+			hash ^= word;
+			hash = ((hash << 27) | (hash >> 37)) * 5 + 0x52DCE729;
+		}
+
+		// Final mix, so that every input bit affects every output bit
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCDULL;
+		hash ^= hash >> 33;
+		hash *= 0xC4CEB9FE1A85EC53ULL;
+		hash ^= hash >> 33;
+		return hash;
 	}
 
 }
@@ -11,8 +11,9 @@ namespace ga
 	*/
 	void ChromoTestFeatures::initializeValues(const int t_initialStateId)
 	{
-		for (std::size_t i{ 0 }; i < 16; ++i)
-			sudoku.push_back(1);
+		auto sudoku = getValues<TestSudoku>();
+		for (std::size_t i{ 0 }; i < sudoku.size(); ++i)
+			sudoku[i] = 1;
 		return;
 		if (t_initialStateId == 0)
 		{
@@ -67,7 +68,7 @@ namespace ga
 	*	@return Output stream
 	*/
 	std::ostream& operator<<(std::ostream& t_output, const ChromoTestFeatures& self) {
-		t_output << self.sudoku;
+		t_output << self.getValues<TestSudoku>();
 		//t_output << self.num;
 		//t_output << "\t" << self.num2;
 		//t_output << "\t" << self.bools;
@@ -78,57 +79,6 @@ namespace ga
 		return t_output;
 	}
 
-	/**
-	*	@brief  Writes Chromo data to a CSV file stream.
-	*
-	*	@param  t_oStream specifies the file stream to write to
-	*	@return void
-	*/
-	void ChromoTestFeatures::writeDataToCSV(std::ostream& oStream)
-	{
-		bif::Import::writeVectorToCSVStream(oStream, num);
-		bif::Import::writeVectorToCSVStream(oStream, num2);
-		bif::Import::writeBoolVectorToCSVStream(oStream, bools);
-		bif::Import::writeVectorToCSVStream(oStream, floats);
-		bif::Import::writeVectorToCSVStream(oStream, betterFloats);
-	}
-
-	/**
-	*	@brief  Reads Chromo data from a CSV line
-	*
-	*	@param  t_chromoValues is a vector of strings containing the CSV row values
-	*	@return void
-	*/
-	void ChromoTestFeatures::readDataFromCSV(std::vector<std::string>& chromoValues)
-	{
-		num = bif::Import::vectorStringToVector<short>(chromoValues, 2);
-		num2 = bif::Import::vectorStringToVector<int>(chromoValues, 2);
-		bools = bif::Import::vectorStringToBoolVector(chromoValues, 6);
-		floats = bif::Import::vectorStringToVector<float>(chromoValues, 2);
-		betterFloats = bif::Import::vectorStringToVector<float>(chromoValues, 2);
-	}
-
-	/**
-	*	@brief  This is a static function used by GeneticAlgorithm.h to obtain the data partitions within the encoded chromosome.
-	*
-	*	@param  t_indices specifies the vector of partitions to be modified
-	*   @param  t_mutateBytes specifies the number of bytes allowed for the crossover and mutation phases
-	*	@return void
-	*/
-	void ChromoTestFeatures::getEncodedPartitions(std::vector<EncodedPartition>& t_indices, MutationLimits& t_mutationLimits)
-	{
-		t_indices.clear();
-		std::size_t location{ 0 };
-		t_mutationLimits.bytes = 0;
-		t_mutationLimits.partitions = 0;
-		Chromo::addItemIndicesOfVector(t_indices, t_mutationLimits, location, sizeof(short int), 16, "Sudoku", true);
-		/*Chromo::addItemIndicesOfVector(t_indices, t_mutationLimits, location, sizeof(short int), 2, "RandomShort", true);
-		Chromo::addItemIndicesOfVector(t_indices, t_mutationLimits, location, sizeof(int), 2, "RandomInt", true);
-		Chromo::addItemIndicesOfBoolVector(t_indices, t_mutationLimits, location, 6, "Bools", true);
-		Chromo::addItemIndicesOfVector(t_indices, t_mutationLimits, location, sizeof(float), 2, "RandomFloat", true);
-		Chromo::addItemIndicesOfVector(t_indices, t_mutationLimits, location, sizeof(float), 2, "BetterFloat", false);*/
-	}
-
 	/**
 	*	@brief  Runs the fitness function for this chromosome. This operates locally and does not affect other chromosomes that are being tested.
 	*
@@ -138,12 +88,13 @@ namespace ga
 	{
 		double total{ 0 };
 		int penalty{ 0 };
+		const auto sudoku = getValues<TestSudoku>();
 
 		// Test lines
 		for (std::size_t i{ 0 }; i < 4; ++i)
 		{
-			std::vector<bool> hasNumH = { false, false, false, false };
-			std::vector<bool> hasNumV = { false, false, false, false };
+			std::array<bool, 4> hasNumH = { false, false, false, false };
+			std::array<bool, 4> hasNumV = { false, false, false, false };
 			for (std::size_t j{ 0 }; j < 4; ++j)
 			{
 				short int val;
@@ -168,7 +119,7 @@ namespace ga
 			for (std::size_t j{ 0 }; j < 2; ++j)
 			{
 				// Test inside cluster
-				std::vector<bool> hasNum = { false, false, false, false };
+				std::array<bool, 4> hasNum = { false, false, false, false };
 				for (std::size_t x{ 0 }; x < 2; ++x)
 				{
 					for (std::size_t y{ 0 }; y < 2; ++y)
@@ -212,55 +163,6 @@ namespace ga
 		Chromo::setScore(total);
 	}
 
-	/**
-	*	@brief  Converts chromosome data values into a string meant to be crossed over and/or mutated.
-	*
-	*	@return void
-	*/
-	void ChromoTestFeatures::encode()
-	{
-		m_encoded = "";
-
-		// Calculate string size needed
-		std::size_t encodedSize{ 0 };
-		encodedSize += sizeof(sudoku.at(0)) * sudoku.size();
-		/*encodedSize += sizeof(num.at(0)) * num.size();
-		encodedSize += sizeof(num2.at(0)) * num2.size();
-		encodedSize += (bools.size() / 8 + 1);
-		encodedSize += sizeof(floats.at(0)) * floats.size();
-		encodedSize += sizeof(betterFloats.at(0)) * betterFloats.size();*/
-		
-		// Reserve string memory
-		m_encoded.reserve(encodedSize + 1);
-
-		m_encoded += encodeVector(sudoku);
-		/*m_encoded += encodeVector(num);
-		m_encoded += encodeVector(num2);
-		m_encoded += encodeBoolVector(bools);
-		m_encoded += encodeVector(floats);
-		m_encoded += encodeVector(betterFloats);*/
-	}
-
-	/**
-	*	@brief  Converts the encoded string into data values used in fitness function.
-	*
-	*	@return void
-	*/
-	void ChromoTestFeatures::decode()
-	{
-		if (m_encoded.length() > 0) {
-			std::size_t curStrIndex{ 0 };
-			curStrIndex = decodeVector(sudoku, m_encoded, curStrIndex);
-			/*curStrIndex = decodeVector(num, m_encoded, curStrIndex);
-			curStrIndex = decodeVector(num2, m_encoded, curStrIndex);
-			curStrIndex = decodeBoolVector(bools, m_encoded, curStrIndex);
-			curStrIndex = decodeVector(floats, m_encoded, curStrIndex);
-			curStrIndex = decodeVector(betterFloats, m_encoded, curStrIndex);*/
-		} else {
-			std::cout << "ERROR: Encoded string not found!";
-		}
-	}
-
 	/**
 	*	@brief  Performs custom mutations on data values
 	*	These data values should be part of the encoded string,
@@ -287,7 +189,7 @@ namespace ga
 	*/
 	void ChromoTestFeatures::applyLimits()
 	{
-		limitVectorModulo(sudoku, static_cast<short int>(0), static_cast<short int>(3));
+		limitVectorModulo(getValues<TestSudoku>(), static_cast<short int>(0), static_cast<short int>(3));
 		/*limitVectorModulo(num, static_cast<short int>(-100), static_cast<short int>(100));
 		limitVectorModulo(num2, static_cast<int>(-100), static_cast<int>(100));
 		limitVectorModuloDouble(floats, static_cast<float>(-100), static_cast<float>(100));
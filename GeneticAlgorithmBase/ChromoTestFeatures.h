@@ -16,17 +16,26 @@
 #endif	// _MSC_VER
 
 #include <unordered_map>
+#include <array>
 
-#include "Chromo.h"
+#include "GenomeSchema.h"
 
 namespace ga
 {
-	class ChromoTestFeatures : public Chromo
+	// A 4x4 sudoku, with values wrapped into [0, 3] by applyLimits()
+	struct TestSudoku : GenomeField<short int, 16>
+	{
+		static const char* name() { return "Sudoku"; }
+	};
+
+	// The sudoku is a view of the encoded data, so crossovers and mutations
+	// change it directly, with nothing to encode or decode
+	class ChromoTestFeatures : public SchemaChromo<GenomeSchema<TestSudoku>, true>
 	{
 	public:
 		using Chromo::setScore;
-		explicit ChromoTestFeatures(const int t_initialStateId, int(*t_randomGenerator)(void))
-			: Chromo(t_initialStateId, t_randomGenerator)
+		explicit ChromoTestFeatures(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
+			: SchemaChromo(t_initialStateId, t_randomGenerator)
 		{
 			initializeValues(t_initialStateId);
 		};
@@ -41,23 +50,14 @@ namespace ga
 		const static bool hasCustomMutations() { return true; };
 
 		// Data processing
-		void encode();
-		void decode();
+		// Encoding, partitions and file I/O come from SchemaChromo
 		void applyLimits();
 
-		// Extra info to be used during crossovers and mutations
-		static void getEncodedPartitions(std::vector<EncodedPartition>&, MutationLimits&);
-
 		// Custom output
 		friend std::ostream& operator<<(std::ostream&, const ChromoTestFeatures&);
 
-	protected:
-		// Input/output
-		void writeDataToCSV(std::ostream&);
-		void readDataFromCSV(std::vector<std::string>&);
-
 	private:
-		std::vector<short int> sudoku;
+		// Not encoded
 		std::vector<short int> num;
 		std::vector<int> num2;
 		std::vector<bool> bools;
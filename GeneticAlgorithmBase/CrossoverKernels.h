@@ -0,0 +1,232 @@
+/**
+* @class CrossoverKernels.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains vectorized kernels used by the crossover methods in ChromoSerialization.h
+*
+* A uniform crossover is a blend of two parents through a random mask:
+*	result = (parent1 AND mask) OR (parent2 AND NOT mask)
+* A byte mask (every byte 0x00 or 0xFF) chooses whole bytes, while a mask of
+* random bits chooses every bit separately.
+*
+* Blends are done 32 bytes at a time with AVX2, 16 bytes at a time with SSE2,
+* or 8 bytes at a time otherwise. The fastest level supported by the CPU is
+* detected once, the first time a blend runs.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef CROSSOVER_KERNELS_H_
+#define CROSSOVER_KERNELS_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define GA_SIMD_X86_
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif	// _MSC_VER
+#endif
+
+// GCC and Clang only emit AVX2 instructions in functions marked for it,
+// while MSVC allows the intrinsics anywhere
+#if defined(GA_SIMD_X86_) && (defined(__GNUC__) || defined(__clang__))
+#define GA_TARGET_SSE2_ __attribute__((target("sse2")))
+#define GA_TARGET_AVX2_ __attribute__((target("avx2")))
+#else
+#define GA_TARGET_SSE2_
+#define GA_TARGET_AVX2_
+#endif
+
+namespace ga
+{
+	enum class SimdLevel { scalar, sse2, avx2 };
+
+	/**
+	*	@brief  Finds the fastest instruction set supported by this CPU and operating system.
+	*
+	*	@return SimdLevel to use
+	*/
+	inline SimdLevel detectSimdLevel()
+	{
+#if defined(GA_SIMD_X86_) && defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		const int maxLeaf{ info[0] };
+
+		__cpuid(info, 1);
+		const bool hasSse2{ (info[3] & (1 << 26)) != 0 };
+		// AVX registers must also be saved by the operating system
+		const bool hasOsAvx{ (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6 };
+
+		bool hasAvx2{ false };
+		if (maxLeaf >= 7 && hasOsAvx) {
+			__cpuidex(info, 7, 0);
+			hasAvx2 = (info[1] & (1 << 5)) != 0;
+		}
+
+		return hasAvx2 ? SimdLevel::avx2 : (hasSse2 ? SimdLevel::sse2 : SimdLevel::scalar);
+#elif defined(GA_SIMD_X86_)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2")) {
+			return SimdLevel::avx2;
+		}
+		return __builtin_cpu_supports("sse2") ? SimdLevel::sse2 : SimdLevel::scalar;
+#else
+		return SimdLevel::scalar;
+#endif
+	}
+
+	/**
+	*	@brief  Returns the SimdLevel used by blendEncodedBytes(), detected on the first call.
+	*
+	*	@return SimdLevel in use
+	*/
+	inline SimdLevel getSimdLevel()
+	{
+		static const SimdLevel simdLevel{ detectSimdLevel() };
+		return simdLevel;
+	}
+
+	/**
+	*	@brief  Blends two byte arrays through a mask, 8 bytes at a time.
+	*	Bits set in the mask are taken from the 1st source.
+	*	The result may not overlap either source.
+	*
+	*	@param  t_source1 specifies the 1st source
+	*	@param  t_source2 specifies the 2nd source
+	*	@param  t_mask specifies the mask
+	*	@param  t_result specifies the output
+	*	@param  t_bytes specifies the number of bytes
+	*	@return void
+	*/
+	inline void blendEncodedBytesScalar(const char* t_source1, const char* t_source2, const unsigned char* t_mask, char* t_result, const std::size_t t_bytes)
+	{
+		std::size_t i{ 0 };
+		for (; i + 8 <= t_bytes; i += 8)
+		{
+			std::uint64_t word1, word2, mask;
+			std::memcpy(&word1, t_source1 + i, 8);
+			std::memcpy(&word2, t_source2 + i, 8);
+			std::memcpy(&mask, t_mask + i, 8);
+			const std::uint64_t blended{ (word1 & mask) | (word2 & ~mask) };
+			std::memcpy(t_result + i, &blended, 8);
+		}
+		for (; i < t_bytes; ++i) {
+			t_result[i] = static_cast<char>((t_source1[i] & t_mask[i]) | (t_source2[i] & ~t_mask[i]));
+		}
+	}
+
+#ifdef GA_SIMD_X86_
+	/**
+	*	@brief  Blends two byte arrays through a mask, 16 bytes at a time.
+	*	See blendEncodedBytesScalar().
+	*
+	*	@return void
+	*/
+	GA_TARGET_SSE2_ inline void blendEncodedBytesSse2(const char* t_source1, const char* t_source2, const unsigned char* t_mask, char* t_result, const std::size_t t_bytes)
+	{
+		std::size_t i{ 0 };
+		for (; i + 16 <= t_bytes; i += 16)
+		{
+			const __m128i source1{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(t_source1 + i)) };
+			const __m128i source2{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(t_source2 + i)) };
+			const __m128i mask{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(t_mask + i)) };
+			const __m128i blended{ _mm_or_si128(_mm_and_si128(mask, source1), _mm_andnot_si128(mask, source2)) };
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(t_result + i), blended);
+		}
+		blendEncodedBytesScalar(t_source1 + i, t_source2 + i, t_mask + i, t_result + i, t_bytes - i);
+	}
+
+	/**
+	*	@brief  Blends two byte arrays through a mask, 32 bytes at a time.
+	*	See blendEncodedBytesScalar(). Only call this if the CPU supports AVX2.
+	*
+	*	@return void
+	*/
+	GA_TARGET_AVX2_ inline void blendEncodedBytesAvx2(const char* t_source1, const char* t_source2, const unsigned char* t_mask, char* t_result, const std::size_t t_bytes)
+	{
+		std::size_t i{ 0 };
+		for (; i + 32 <= t_bytes; i += 32)
+		{
+			const __m256i source1{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(t_source1 + i)) };
+			const __m256i source2{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(t_source2 + i)) };
+			const __m256i mask{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(t_mask + i)) };
+			const __m256i blended{ _mm256_or_si256(_mm256_and_si256(mask, source1), _mm256_andnot_si256(mask, source2)) };
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(t_result + i), blended);
+		}
+		blendEncodedBytesScalar(t_source1 + i, t_source2 + i, t_mask + i, t_result + i, t_bytes - i);
+	}
+#endif	// GA_SIMD_X86_
+
+	/**
+	*	@brief  Blends two byte arrays through a mask, using a chosen instruction set.
+	*	Levels not available on this platform fall back to scalar code.
+	*
+	*	@param  t_source1 specifies the 1st source
+	*	@param  t_source2 specifies the 2nd source
+	*	@param  t_mask specifies the mask. Bits set are taken from the 1st source.
+	*	@param  t_result specifies the output, which may not overlap either source
+	*	@param  t_bytes specifies the number of bytes
+	*	@param  t_simdLevel specifies the instruction set. The CPU must support it.
+	*	@return void
+	*/
+	inline void blendEncodedBytes(const char* t_source1, const char* t_source2, const unsigned char* t_mask, char* t_result, const std::size_t t_bytes, const SimdLevel t_simdLevel)
+	{
+#ifdef GA_SIMD_X86_
+		if (t_simdLevel == SimdLevel::avx2) {
+			blendEncodedBytesAvx2(t_source1, t_source2, t_mask, t_result, t_bytes);
+			return;
+		}
+		if (t_simdLevel == SimdLevel::sse2) {
+			blendEncodedBytesSse2(t_source1, t_source2, t_mask, t_result, t_bytes);
+			return;
+		}
+#endif	// GA_SIMD_X86_
+		blendEncodedBytesScalar(t_source1, t_source2, t_mask, t_result, t_bytes);
+	}
+
+	/**
+	*	@brief  Blends two byte arrays through a mask, using the fastest instruction set available.
+	*
+	*	@return void
+	*/
+	inline void blendEncodedBytes(const char* t_source1, const char* t_source2, const unsigned char* t_mask, char* t_result, const std::size_t t_bytes)
+	{
+		blendEncodedBytes(t_source1, t_source2, t_mask, t_result, t_bytes, getSimdLevel());
+	}
+
+	/**
+	*	@brief  Expands 64 random bits into a 64 byte mask, where bit i chooses byte i.
+	*	Each group of 8 bits is spread across a word with a multiply,
+	*	so there is no branch per byte.
+	*
+	*	@param  t_bits specifies the random bits
+	*	@param  t_mask specifies the output, which must have room for 64 bytes
+	*	@return void
+	*/
+	inline void expandBitsToByteMask(std::uint64_t t_bits, unsigned char* t_mask)
+	{
+		const std::uint64_t lowBits{ 0x7F7F7F7F7F7F7F7FULL };
+		const std::uint64_t highBits{ 0x8080808080808080ULL };
+		for (std::size_t i{ 0 }; i < 64; i += 8)
+		{
+			// Byte k of spread is nonzero if bit k is set
+			const std::uint64_t spread{ ((t_bits & 0xFF) * 0x0101010101010101ULL) & 0x8040201008040201ULL };
+			// Move each nonzero byte's flag to its high bit, then fill the byte
+			const std::uint64_t flags{ (((spread & lowBits) + lowBits) | spread) & highBits };
+			const std::uint64_t mask{ (flags >> 7) * 0xFF };
+			std::memcpy(t_mask + i, &mask, 8);
+			t_bits >>= 8;
+		}
+	}
+
+} // namespace ga
+
+#endif	// CROSSOVER_KERNELS_H_
@@ -0,0 +1,377 @@
+/**
+* @class EncodedData.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains the byte storage used for a Chromo's encoded data
+*
+* EncodedData supports the parts of std::string used by encode() and decode()
+* ( = "", +=, reserve(), length(), at(), [] ), so existing Chromo classes work unchanged.
+*
+* By default, the data is stored in its own heap buffer. It can instead be bound
+* to a fixed-size slot in a PopulationBuffer, so that every Chromo in a GA shares
+* one contiguous block of memory. If bound data grows past its slot, it is moved
+* back into its own buffer rather than overflowing into the next slot.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef ENCODED_DATA_H_
+#define ENCODED_DATA_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <string>
+#include <cstring>
+#include <stdexcept>
+#include <ostream>
+
+namespace ga
+{
+	class EncodedData
+	{
+	public:
+		EncodedData() {};
+		EncodedData(const std::string& t_string)
+		{
+			assign(t_string.data(), t_string.length());
+		};
+		// Copies are never bound
+		EncodedData(const EncodedData& t_other)
+		{
+			assign(t_other.m_data, t_other.m_length);
+		};
+		~EncodedData()
+		{
+			if (!m_isBound) {
+				delete[] m_data;
+			}
+		};
+
+		// Assignment copies bytes into the existing storage
+		EncodedData& operator=(const EncodedData&);
+		EncodedData& operator=(const std::string&);
+		EncodedData& operator=(const char*);
+		EncodedData& operator+=(const EncodedData&);
+		EncodedData& operator+=(const std::string&);
+		EncodedData& operator+=(const char);
+
+		void assign(const char*, const std::size_t);
+		void append(const char*, const std::size_t);
+		void reserve(const std::size_t);
+		void resize(const std::size_t);
+		void clear();
+
+		std::size_t length() const;
+		std::size_t size() const;
+		std::size_t capacity() const;
+		bool empty() const;
+
+		char& operator[](const std::size_t);
+		const char& operator[](const std::size_t) const;
+		char& at(const std::size_t);
+		const char& at(const std::size_t) const;
+		char* begin();
+		const char* begin() const;
+		char* end();
+		const char* end() const;
+		char* data();
+		const char* data() const;
+
+		std::string toString() const;
+
+		// Contiguous storage
+		bool bind(char*, const std::size_t);
+		void unbind();
+		bool isBound() const;
+
+		friend std::ostream& operator<<(std::ostream& output, const EncodedData& self) {
+			output.write(self.m_data, self.m_length);
+			return output;
+		}
+
+	private:
+		void grow(const std::size_t);
+
+		char* m_data{ nullptr };
+		std::size_t m_length{ 0 };
+		std::size_t m_capacity{ 0 };
+		// True if m_data points into a PopulationBuffer, which owns the memory
+		bool m_isBound{ false };
+	};
+
+	inline EncodedData& EncodedData::operator=(const EncodedData& t_other)
+	{
+		if (this != &t_other) {
+			assign(t_other.m_data, t_other.m_length);
+		}
+		return *this;
+	}
+
+	inline EncodedData& EncodedData::operator=(const std::string& t_string)
+	{
+		assign(t_string.data(), t_string.length());
+		return *this;
+	}
+
+	inline EncodedData& EncodedData::operator=(const char* t_chars)
+	{
+		assign(t_chars, std::strlen(t_chars));
+		return *this;
+	}
+
+	inline EncodedData& EncodedData::operator+=(const EncodedData& t_other)
+	{
+		append(t_other.m_data, t_other.m_length);
+		return *this;
+	}
+
+	inline EncodedData& EncodedData::operator+=(const std::string& t_string)
+	{
+		append(t_string.data(), t_string.length());
+		return *this;
+	}
+
+	inline EncodedData& EncodedData::operator+=(const char t_char)
+	{
+		append(&t_char, 1);
+		return *this;
+	}
+
+	/**
+	*	@brief  Replaces the data with a copy of a byte array.
+	*
+	*	@param  t_chars points to the bytes to copy
+	*	@param  t_count specifies the number of bytes
+	*	@return void
+	*/
+	inline void EncodedData::assign(const char* t_chars, const std::size_t t_count)
+	{
+		m_length = 0;
+		append(t_chars, t_count);
+	}
+
+	/**
+	*	@brief  Adds a copy of a byte array to the end of the data.
+	*
+	*	@param  t_chars points to the bytes to copy
+	*	@param  t_count specifies the number of bytes
+	*	@return void
+	*/
+	inline void EncodedData::append(const char* t_chars, const std::size_t t_count)
+	{
+		if (m_length + t_count > m_capacity) {
+			// The source may be part of this data, which is about to move
+			const bool isSelf{ t_chars >= m_data && t_chars < m_data + m_length };
+			const std::size_t offset{ isSelf ? static_cast<std::size_t>(t_chars - m_data) : 0 };
+			grow(m_length + t_count);
+			if (isSelf) {
+				t_chars = m_data + offset;
+			}
+		}
+		if (t_count > 0) {
+			std::memmove(m_data + m_length, t_chars, t_count);
+		}
+		m_length += t_count;
+	}
+
+	/**
+	*	@brief  Makes room for at least the requested number of bytes.
+	*	Like std::string, this is only a hint. Bound data stays in its
+	*	slot until it actually grows past it.
+	*
+	*	@param  t_capacity specifies the minimum capacity
+	*	@return void
+	*/
+	inline void EncodedData::reserve(const std::size_t t_capacity)
+	{
+		if (t_capacity > m_capacity && !m_isBound) {
+			grow(t_capacity);
+		}
+	}
+
+	/**
+	*	@brief  Changes the length of the data. New bytes are set to 0.
+	*
+	*	@param  t_length specifies the new length
+	*	@return void
+	*/
+	inline void EncodedData::resize(const std::size_t t_length)
+	{
+		if (t_length > m_capacity) {
+			grow(t_length);
+		}
+		if (t_length > m_length) {
+			std::memset(m_data + m_length, 0, t_length - m_length);
+		}
+		m_length = t_length;
+	}
+
+	inline void EncodedData::clear()
+	{
+		m_length = 0;
+	}
+
+	inline std::size_t EncodedData::length() const
+	{
+		return m_length;
+	}
+
+	inline std::size_t EncodedData::size() const
+	{
+		return m_length;
+	}
+
+	inline std::size_t EncodedData::capacity() const
+	{
+		return m_capacity;
+	}
+
+	inline bool EncodedData::empty() const
+	{
+		return m_length == 0;
+	}
+
+	inline char& EncodedData::operator[](const std::size_t t_index)
+	{
+		return m_data[t_index];
+	}
+
+	inline const char& EncodedData::operator[](const std::size_t t_index) const
+	{
+		return m_data[t_index];
+	}
+
+	inline char& EncodedData::at(const std::size_t t_index)
+	{
+		if (t_index >= m_length) {
+			throw std::out_of_range("EncodedData::at");
+		}
+		return m_data[t_index];
+	}
+
+	inline const char& EncodedData::at(const std::size_t t_index) const
+	{
+		if (t_index >= m_length) {
+			throw std::out_of_range("EncodedData::at");
+		}
+		return m_data[t_index];
+	}
+
+	inline char* EncodedData::begin()
+	{
+		return m_data;
+	}
+
+	inline const char* EncodedData::begin() const
+	{
+		return m_data;
+	}
+
+	inline char* EncodedData::end()
+	{
+		return m_data + m_length;
+	}
+
+	inline const char* EncodedData::end() const
+	{
+		return m_data + m_length;
+	}
+
+	inline char* EncodedData::data()
+	{
+		return m_data;
+	}
+
+	inline const char* EncodedData::data() const
+	{
+		return m_data;
+	}
+
+	/**
+	*	@brief  Returns a copy of the data as a string.
+	*
+	*	@return string containing the encoded data
+	*/
+	inline std::string EncodedData::toString() const
+	{
+		return std::string(m_data, m_length);
+	}
+
+	/**
+	*	@brief  Moves the data into a slot owned by a PopulationBuffer.
+	*	The current data is copied into the slot, if it fits.
+	*
+	*	@param  t_slot points to the start of the slot
+	*	@param  t_slotCapacity specifies the number of bytes in the slot
+	*	@return true if the data was moved, false if it does not fit (it then stays in its own buffer)
+	*/
+	inline bool EncodedData::bind(char* t_slot, const std::size_t t_slotCapacity)
+	{
+		if (m_length > t_slotCapacity) {
+			return false;
+		}
+
+		if (m_length > 0) {
+			std::memcpy(t_slot, m_data, m_length);
+		}
+		if (!m_isBound) {
+			delete[] m_data;
+		}
+		m_data = t_slot;
+		m_capacity = t_slotCapacity;
+		m_isBound = true;
+		return true;
+	}
+
+	/**
+	*	@brief  Moves the data out of its PopulationBuffer slot and into its own buffer.
+	*	Must be called before the PopulationBuffer is destroyed.
+	*
+	*	@return void
+	*/
+	inline void EncodedData::unbind()
+	{
+		if (m_isBound) {
+			grow(m_length);
+		}
+	}
+
+	inline bool EncodedData::isBound() const
+	{
+		return m_isBound;
+	}
+
+	/**
+	*	@brief  Moves the data to a new heap buffer of at least the requested size.
+	*	Bound data leaves its slot, since slots cannot grow.
+	*
+	*	@param  t_capacity specifies the minimum capacity
+	*	@return void
+	*/
+	inline void EncodedData::grow(const std::size_t t_capacity)
+	{
+		std::size_t newCapacity{ m_isBound ? t_capacity : m_capacity * 2 };
+		if (newCapacity < t_capacity) {
+			newCapacity = t_capacity;
+		}
+		if (newCapacity < 16) {
+			newCapacity = 16;
+		}
+
+		char* newData{ new char[newCapacity] };
+		if (m_length > 0) {
+			std::memcpy(newData, m_data, m_length);
+		}
+		if (!m_isBound) {
+			delete[] m_data;
+		}
+		m_data = newData;
+		m_capacity = newCapacity;
+		m_isBound = false;
+	}
+
+} // namespace ga
+
+#endif	// ENCODED_DATA_H_
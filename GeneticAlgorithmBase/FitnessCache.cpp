@@ -0,0 +1,251 @@
+#include "FitnessCache.h"
+
+namespace ga
+{
+	const std::size_t FitnessCache::npos;
+
+	/**
+	*	@brief  Allocates space for every entry up front.
+	*	The hash table has at least twice as many slots as entries,
+	*	which keeps probe sequences short.
+	*
+	*	@param  t_capacity is the maximum number of scores to keep. Must be at least 1.
+	*/
+	FitnessCache::FitnessCache(const std::size_t t_capacity)
+		: m_entries(t_capacity > 0 ? t_capacity : 1)
+	{
+		std::size_t slotCount{ 16 };
+		while (slotCount < m_entries.size() * 2) {
+			slotCount <<= 1;
+		}
+		m_slots.assign(slotCount, npos);
+		m_slotMask = slotCount - 1;
+	}
+
+	/**
+	*	@brief  Looks up a score. A found score becomes the most recently used.
+	*
+	*	@param  t_key specifies the hash of the encoded string
+	*	@param  t_score is set to the cached score if found
+	*	@return true if the score was found, false otherwise
+	*/
+	bool FitnessCache::find(const std::uint64_t t_key, double& t_score)
+	{
+		const std::size_t slot{ findSlot(t_key) };
+		if (m_slots[slot] == npos) {
+			++m_misses;
+			return false;
+		}
+
+		const std::size_t entryId{ m_slots[slot] };
+		t_score = m_entries[entryId].score;
+		unlink(entryId);
+		pushFront(entryId);
+		++m_hits;
+		return true;
+	}
+
+	/**
+	*	@brief  Adds a score to the cache, or updates it if the key is already cached.
+	*	When the cache is full, the least recently used score is removed.
+	*
+	*	@param  t_key specifies the hash of the encoded string
+	*	@param  t_score specifies the fitness score
+	*	@return void
+	*/
+	void FitnessCache::insert(const std::uint64_t t_key, const double t_score)
+	{
+		std::size_t slot{ findSlot(t_key) };
+		if (m_slots[slot] != npos) {
+			// Already cached
+			const std::size_t entryId{ m_slots[slot] };
+			m_entries[entryId].score = t_score;
+			unlink(entryId);
+			pushFront(entryId);
+			return;
+		}
+
+		std::size_t entryId{ m_size };
+		if (m_size == m_entries.size()) {
+			// Full, so reuse the least recently used entry
+			entryId = m_tail;
+			unlink(entryId);
+			eraseSlot(findSlot(m_entries[entryId].key));
+			// Erasing may have moved other keys, so search again
+			slot = findSlot(t_key);
+		}
+		else {
+			++m_size;
+		}
+
+		m_entries[entryId].key = t_key;
+		m_entries[entryId].score = t_score;
+		m_slots[slot] = entryId;
+		pushFront(entryId);
+	}
+
+	/**
+	*	@brief  Removes every score. Counters are not reset.
+	*
+	*	@return void
+	*/
+	void FitnessCache::clear()
+	{
+		m_slots.assign(m_slots.size(), npos);
+		m_size = 0;
+		m_head = npos;
+		m_tail = npos;
+	}
+
+	/**
+	*	@brief  Returns the number of cached scores.
+	*
+	*	@return m_size
+	*/
+	std::size_t FitnessCache::getSize() const
+	{
+		return m_size;
+	}
+
+	/**
+	*	@brief  Returns the maximum number of cached scores.
+	*
+	*	@return Capacity
+	*/
+	std::size_t FitnessCache::getCapacity() const
+	{
+		return m_entries.size();
+	}
+
+	/**
+	*	@brief  Returns the number of successful lookups.
+	*
+	*	@return m_hits
+	*/
+	unsigned long long int FitnessCache::getHits() const
+	{
+		return m_hits;
+	}
+
+	/**
+	*	@brief  Returns the number of failed lookups.
+	*
+	*	@return m_misses
+	*/
+	unsigned long long int FitnessCache::getMisses() const
+	{
+		return m_misses;
+	}
+
+	/**
+	*	@brief  Sets the hit and miss counters to 0.
+	*
+	*	@return void
+	*/
+	void FitnessCache::resetCounters()
+	{
+		m_hits = 0;
+		m_misses = 0;
+	}
+
+	/**
+	*	@brief  Finds the slot holding a key, or the empty slot where it would be inserted.
+	*
+	*	@param  t_key specifies the key
+	*	@return Slot index
+	*/
+	std::size_t FitnessCache::findSlot(const std::uint64_t t_key) const
+	{
+		std::size_t slot{ getHomeSlot(t_key) };
+		while (m_slots[slot] != npos && m_entries[m_slots[slot]].key != t_key) {
+			slot = (slot + 1) & m_slotMask;
+		}
+		return slot;
+	}
+
+	/**
+	*	@brief  Returns the first slot probed for a key.
+	*	Keys are already hashes, but the bits are mixed again in
+	*	case the low bits are poorly distributed.
+	*
+	*	@param  t_key specifies the key
+	*	@return Slot index
+	*/
+	std::size_t FitnessCache::getHomeSlot(const std::uint64_t t_key) const
+	{
+		return static_cast<std::size_t>((t_key * 0x9E3779B97F4A7C15ULL) >> 32) & m_slotMask;
+	}
+
+	/**
+	*	@brief  Empties a hash table slot.
+	*	Uses backward-shift deletion, which moves later keys in
+	*	the same probe sequence back so that lookups still find them.
+	*
+	*	@param  t_slot specifies the slot to empty
+	*	@return void
+	*/
+	void FitnessCache::eraseSlot(std::size_t t_slot)
+	{
+		std::size_t next{ t_slot };
+		while (true)
+		{
+			next = (next + 1) & m_slotMask;
+			if (m_slots[next] == npos) {
+				break;
+			}
+
+			// Move the key back if its home slot is not between the hole and its current slot
+			const std::size_t home{ getHomeSlot(m_entries[m_slots[next]].key) };
+			const bool isHomeInRange{ t_slot <= next ? (home > t_slot && home <= next) : (home > t_slot || home <= next) };
+			if (!isHomeInRange) {
+				m_slots[t_slot] = m_slots[next];
+				t_slot = next;
+			}
+		}
+		m_slots[t_slot] = npos;
+	}
+
+	/**
+	*	@brief  Removes an entry from the recently used list.
+	*
+	*	@param  t_entryId specifies the entry
+	*	@return void
+	*/
+	void FitnessCache::unlink(const std::size_t t_entryId)
+	{
+		Entry& entry{ m_entries[t_entryId] };
+		if (entry.previous != npos) {
+			m_entries[entry.previous].next = entry.next;
+		}
+		else {
+			m_head = entry.next;
+		}
+		if (entry.next != npos) {
+			m_entries[entry.next].previous = entry.previous;
+		}
+		else {
+			m_tail = entry.previous;
+		}
+	}
+
+	/**
+	*	@brief  Adds an entry to the front of the recently used list.
+	*
+	*	@param  t_entryId specifies the entry
+	*	@return void
+	*/
+	void FitnessCache::pushFront(const std::size_t t_entryId)
+	{
+		Entry& entry{ m_entries[t_entryId] };
+		entry.previous = npos;
+		entry.next = m_head;
+		if (m_head != npos) {
+			m_entries[m_head].previous = t_entryId;
+		}
+		m_head = t_entryId;
+		if (m_tail == npos) {
+			m_tail = t_entryId;
+		}
+	}
+
+} // namespace ga
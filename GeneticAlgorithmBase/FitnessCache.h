@@ -0,0 +1,77 @@
+/**
+* @class FitnessCache.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a bounded, least-recently-used cache of fitness scores keyed by encoded string hashes
+*
+* Used by GeneticAlgorithm so that identical genomes are only scored once.
+* All memory is allocated up front, so lookups and inserts never allocate.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef FITNESS_CACHE_H_
+#define FITNESS_CACHE_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <cstdint>
+
+namespace ga
+{
+	class FitnessCache
+	{
+	public:
+		explicit FitnessCache(const std::size_t t_capacity);
+
+		// Returns true and sets the score if the key is cached
+		bool find(const std::uint64_t, double&);
+		// Adds or updates a score, removing the least recently used score if full
+		void insert(const std::uint64_t, const double);
+		void clear();
+
+		std::size_t getSize() const;
+		std::size_t getCapacity() const;
+
+		// Lookup counters
+		unsigned long long int getHits() const;
+		unsigned long long int getMisses() const;
+		void resetCounters();
+
+	private:
+		struct Entry
+		{
+			std::uint64_t key;
+			double score;
+			// Doubly linked list, most recently used first
+			std::size_t previous;
+			std::size_t next;
+		};
+
+		std::size_t findSlot(const std::uint64_t) const;
+		std::size_t getHomeSlot(const std::uint64_t) const;
+		void eraseSlot(std::size_t);
+		void unlink(const std::size_t);
+		void pushFront(const std::size_t);
+
+		static const std::size_t npos{ static_cast<std::size_t>(-1) };
+
+		std::vector<Entry> m_entries;
+		// Open-addressed hash table of entry indices (linear probing)
+		std::vector<std::size_t> m_slots;
+		std::size_t m_slotMask{ 0 };
+
+		std::size_t m_size{ 0 };
+		std::size_t m_head{ npos };
+		std::size_t m_tail{ npos };
+
+		unsigned long long int m_hits{ 0 };
+		unsigned long long int m_misses{ 0 };
+	};
+
+} // namespace ga
+
+#endif	// FITNESS_CACHE_H_
@@ -0,0 +1,345 @@
+/**
+* @class FloatFormat.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a function which writes floats with the fewest digits that read back to the same value
+*
+* printf() needs 17 significant digits to be sure a double reads back
+* exactly, which writes 0.1 as 0.10000000000000001, and finding fewer
+* digits that still work means printing and parsing several times. This
+* is the Grisu2 algorithm (F. Loitsch, "Printing Floating-Point Numbers
+* Quickly and Accurately with Integers", 2010), which finds them with
+* 64-bit integer math and no allocation, like std::to_chars in C++17.
+* The digits always read back to the same value, and are almost always
+* the fewest possible.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef FLOAT_FORMAT_H_
+#define FLOAT_FORMAT_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <cstdint>
+#include <cstring>
+
+namespace bif
+{
+	class FloatFormat
+	{
+	public:
+		// Most characters formatShortest() writes
+		static const std::size_t maxLength{ 26 };
+
+		/**
+		*	@brief  Writes a finite double with the fewest digits that read back to the same value
+		*
+		*	@param  t_first points to space for at least maxLength characters
+		*	@param  t_value specifies the number, which must not be infinity or NaN
+		*	@return Pointer one past the last character written (no null is added)
+		*/
+		static char* formatShortest(char* t_first, const double t_value)
+		{
+			std::uint64_t bits;
+			std::memcpy(&bits, &t_value, sizeof(bits));
+			const std::uint64_t significand{ bits & 0x000FFFFFFFFFFFFFULL };
+			const int biasedExponent{ static_cast<int>((bits >> 52) & 0x7FF) };
+			return formatShortest(t_first, (bits >> 63) != 0, significand, biasedExponent, 52, 1075);
+		}
+
+		/**
+		*	@brief  Writes a finite float with the fewest digits that read back to the same float
+		*
+		*	@param  t_first points to space for at least maxLength characters
+		*	@param  t_value specifies the number, which must not be infinity or NaN
+		*	@return Pointer one past the last character written (no null is added)
+		*/
+		static char* formatShortest(char* t_first, const float t_value)
+		{
+			std::uint32_t bits;
+			std::memcpy(&bits, &t_value, sizeof(bits));
+			const std::uint64_t significand{ bits & 0x007FFFFFU };
+			const int biasedExponent{ static_cast<int>((bits >> 23) & 0xFF) };
+			return formatShortest(t_first, (bits >> 31) != 0, significand, biasedExponent, 23, 150);
+		}
+
+	private:
+		// A number f * 2^e, with a 64-bit f
+		struct DiyFp
+		{
+			std::uint64_t f;
+			int e;
+		};
+
+		static DiyFp subtract(const DiyFp t_a, const DiyFp t_b)
+		{
+			return DiyFp{ t_a.f - t_b.f, t_a.e };
+		}
+
+		/**
+		*	@brief  Multiplies two numbers, keeping the upper 64 bits of the product (rounded).
+		*/
+		static DiyFp multiply(const DiyFp t_a, const DiyFp t_b)
+		{
+			const std::uint64_t lowMask{ 0xFFFFFFFFULL };
+			const std::uint64_t a{ t_a.f >> 32 };
+			const std::uint64_t b{ t_a.f & lowMask };
+			const std::uint64_t c{ t_b.f >> 32 };
+			const std::uint64_t d{ t_b.f & lowMask };
+			const std::uint64_t ac{ a * c };
+			const std::uint64_t bc{ b * c };
+			const std::uint64_t ad{ a * d };
+			const std::uint64_t bd{ b * d };
+			std::uint64_t middle{ (bd >> 32) + (ad & lowMask) + (bc & lowMask) };
+			middle += 1ULL << 31;
+			return DiyFp{ ac + (ad >> 32) + (bc >> 32) + (middle >> 32), t_a.e + t_b.e + 64 };
+		}
+
+		static DiyFp normalize(DiyFp t_value)
+		{
+			while ((t_value.f & (1ULL << 63)) == 0)
+			{
+				t_value.f <<= 1;
+				--t_value.e;
+			}
+			return t_value;
+		}
+
+		/**
+		*	@brief  Returns a power of ten c = 10^-k, chosen so that t_exponent + c.e + 64 is in [-60, -32].
+		*/
+		static DiyFp getCachedPower(const int t_exponent, int& t_k)
+		{
+			// 10^-348, 10^-340, ..., 10^340, normalized to 64 bits
+			static const std::uint64_t powerSignificands[]{
+				0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+				0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+				0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+				0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+				0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+				0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+				0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+				0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+				0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+				0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+				0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+				0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+				0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+				0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+				0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+				0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+				0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+				0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+				0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+				0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+				0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+				0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+				0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+				0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+				0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+				0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+				0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+				0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+				0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+			};
+			static const std::int16_t powerExponents[]{
+				-1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927,
+				-901, -874, -847, -821, -794, -768, -741, -715, -688, -661, -635, -608,
+				-582, -555, -529, -502, -475, -449, -422, -396, -369, -343, -316, -289,
+				-263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30,
+				56, 83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+				375, 402, 428, 455, 481, 508, 534, 561, 588, 614, 641, 667,
+				694, 720, 747, 774, 800, 827, 853, 880, 907, 933, 960, 986,
+				1013, 1039, 1066
+			};
+
+			const double dk{ (-61 - t_exponent) * 0.30102999566398114 + 347 };
+			int k{ static_cast<int>(dk) };
+			if (k != dk) {
+				++k;
+			}
+			const unsigned int index{ static_cast<unsigned int>((k >> 3) + 1) };
+			t_k = -(-348 + static_cast<int>(index << 3));
+			return DiyFp{ powerSignificands[index], powerExponents[index] };
+		}
+
+		/**
+		*	@brief  Moves the last digit down while the number stays in range and gets closer to the exact value.
+		*/
+		static void roundWeed(char* t_digits, const int t_length, const std::uint64_t t_delta, std::uint64_t t_rest, const std::uint64_t t_tenKappa, const std::uint64_t t_distance)
+		{
+			while (t_rest < t_distance && t_delta - t_rest >= t_tenKappa &&
+				(t_rest + t_tenKappa < t_distance || t_distance - t_rest > t_rest + t_tenKappa - t_distance))
+			{
+				--t_digits[t_length - 1];
+				t_rest += t_tenKappa;
+			}
+		}
+
+		/**
+		*	@brief  Writes the fewest digits of t_high that stay within t_delta of it.
+		*/
+		static int generateDigits(const DiyFp t_value, const DiyFp t_high, std::uint64_t t_delta, char* t_digits, int& t_k)
+		{
+			static const std::uint64_t powersOf10[]{ 1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+				100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+				100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+				1000000000000000000ULL, 10000000000000000000ULL };
+
+			const int shift{ -t_high.e };
+			const std::uint64_t one{ 1ULL << shift };
+			const std::uint64_t distance{ t_high.f - t_value.f };
+			std::uint32_t integral{ static_cast<std::uint32_t>(t_high.f >> shift) };
+			std::uint64_t fraction{ t_high.f & (one - 1) };
+			int length{ 0 };
+
+			int kappa{ 1 };
+			while (kappa < 10 && integral >= powersOf10[kappa])
+				++kappa;
+
+			// Digits before the binary point
+			while (kappa > 0)
+			{
+				const std::uint32_t divisor{ static_cast<std::uint32_t>(powersOf10[kappa - 1]) };
+				const std::uint32_t digit{ integral / divisor };
+				integral %= divisor;
+				if (digit != 0 || length != 0) {
+					t_digits[length++] = static_cast<char>('0' + digit);
+				}
+				--kappa;
+				const std::uint64_t rest{ (static_cast<std::uint64_t>(integral) << shift) + fraction };
+				if (rest <= t_delta)
+				{
+					t_k += kappa;
+					roundWeed(t_digits, length, t_delta, rest, powersOf10[kappa] << shift, distance);
+					return length;
+				}
+			}
+
+			// Digits after the binary point
+			while (true)
+			{
+				fraction *= 10;
+				t_delta *= 10;
+				const char digit{ static_cast<char>(fraction >> shift) };
+				if (digit != 0 || length != 0) {
+					t_digits[length++] = static_cast<char>('0' + digit);
+				}
+				fraction &= one - 1;
+				--kappa;
+				if (fraction < t_delta)
+				{
+					t_k += kappa;
+					const int index{ -kappa };
+					roundWeed(t_digits, length, t_delta, fraction, one, distance * (index < 20 ? powersOf10[index] : 0));
+					return length;
+				}
+			}
+		}
+
+		/**
+		*	@brief  Writes the number significand * 2^(biasedExponent - t_bias), as digits with a decimal point or exponent.
+		*/
+		static char* formatShortest(char* t_first, const bool t_isNegative, std::uint64_t t_significand, const int t_biasedExponent, const int t_significandBits, const int t_bias)
+		{
+			if (t_isNegative) {
+				*t_first++ = '-';
+			}
+			if (t_significand == 0 && t_biasedExponent == 0)
+			{
+				*t_first = '0';
+				return t_first + 1;
+			}
+
+			// Subnormal numbers have no hidden bit
+			const std::uint64_t hiddenBit{ 1ULL << t_significandBits };
+			int exponent{ 1 - t_bias };
+			if (t_biasedExponent != 0)
+			{
+				t_significand += hiddenBit;
+				exponent = t_biasedExponent - t_bias;
+			}
+
+			// Halfway to each neighbouring number, which is closer below a power of 2
+			const DiyFp high{ normalize(DiyFp{ (t_significand << 1) + 1, exponent - 1 }) };
+			DiyFp low{ (t_significand == hiddenBit && t_biasedExponent > 1) ? DiyFp{ (t_significand << 2) - 1, exponent - 2 } : DiyFp{ (t_significand << 1) - 1, exponent - 1 } };
+			low.f <<= low.e - high.e;
+			low.e = high.e;
+
+			int k;
+			const DiyFp power{ getCachedPower(high.e, k) };
+			const DiyFp scaledValue{ multiply(normalize(DiyFp{ t_significand, exponent }), power) };
+			DiyFp scaledHigh{ multiply(high, power) };
+			DiyFp scaledLow{ multiply(low, power) };
+			++scaledLow.f;
+			--scaledHigh.f;
+
+			char digits[20];
+			const int length{ generateDigits(scaledValue, scaledHigh, scaledHigh.f - scaledLow.f, digits, k) };
+			return writeDigits(t_first, digits, length, k);
+		}
+
+		/**
+		*	@brief  Writes digits * 10^t_k as plain digits when that is short, otherwise with an exponent.
+		*/
+		static char* writeDigits(char* t_first, const char* t_digits, const int t_length, const int t_k)
+		{
+			// The number is in [10^(point - 1), 10^point)
+			const int point{ t_length + t_k };
+			if (t_length <= point && point <= 17)
+			{
+				// 1234e3 -> 1234000
+				std::memcpy(t_first, t_digits, t_length);
+				std::memset(t_first + t_length, '0', point - t_length);
+				return t_first + point;
+			}
+			if (0 < point && point <= 17)
+			{
+				// 1234e-2 -> 12.34
+				std::memcpy(t_first, t_digits, point);
+				t_first[point] = '.';
+				std::memcpy(t_first + point + 1, t_digits + point, t_length - point);
+				return t_first + t_length + 1;
+			}
+			if (-6 < point && point <= 0)
+			{
+				// 1234e-6 -> 0.001234
+				t_first[0] = '0';
+				t_first[1] = '.';
+				std::memset(t_first + 2, '0', -point);
+				std::memcpy(t_first + 2 - point, t_digits, t_length);
+				return t_first + 2 - point + t_length;
+			}
+
+			// 1234e30 -> 1.234e33
+			char* position{ t_first };
+			*position++ = t_digits[0];
+			if (t_length > 1)
+			{
+				*position++ = '.';
+				std::memcpy(position, t_digits + 1, t_length - 1);
+				position += t_length - 1;
+			}
+			*position++ = 'e';
+			int exponent{ point - 1 };
+			if (exponent < 0)
+			{
+				*position++ = '-';
+				exponent = -exponent;
+			}
+			if (exponent >= 100) {
+				*position++ = static_cast<char>('0' + exponent / 100);
+			}
+			if (exponent >= 10) {
+				*position++ = static_cast<char>('0' + exponent / 10 % 10);
+			}
+			*position++ = static_cast<char>('0' + exponent % 10);
+			return position;
+		}
+	};
+}
+
+#endif // FLOAT_FORMAT_H_
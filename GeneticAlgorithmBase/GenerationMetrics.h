@@ -0,0 +1,213 @@
+/**
+* @class GenerationMetrics.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains timings and counters recorded for each generation of a GA
+*
+* Nothing is recorded unless GA_ENABLE_METRICS is defined before any GA
+* header is included (or in the project's preprocessor settings):
+*
+*	#define GA_ENABLE_METRICS
+*	#include "GeneticAlgorithm.h"
+*
+* Without it, the timers and counters compile to nothing, and the metrics
+* returned by the GA are always 0. Metrics are only stored, never printed,
+* so they can be read and written out between generations.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef GENERATION_METRICS_H_
+#define GENERATION_METRICS_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <iostream>
+#include <chrono>
+#include <cstddef>
+
+namespace ga
+{
+	// Timed parts of advanceGeneration()
+	// Sub-steps are included in the time of their phase
+	enum class MetricPhase
+	{
+		total,
+		selection, fitness, sort,
+		crossover, encode, copies, shuffles, crossovers,
+		mutation, mutations, decode, customMutations
+	};
+	const std::size_t metricPhaseCount{ 13 };
+
+	/**
+	*	@brief  Returns the name of a phase, for printing.
+	*
+	*	@param  t_phase specifies the phase
+	*	@return Name of the phase
+	*/
+	inline const char* getMetricPhaseName(const MetricPhase t_phase)
+	{
+		static const char* const names[metricPhaseCount]{
+			"total",
+			"selection", "fitness", "sort",
+			"crossover", "encode", "copies", "shuffles", "crossovers",
+			"mutation", "mutations", "decode", "customMutations"
+		};
+		return names[static_cast<std::size_t>(t_phase)];
+	}
+
+	struct GenerationMetrics
+	{
+	public:
+		// Number of generations recorded
+		unsigned long int generations;
+		// Wall time of each phase, in seconds (see MetricPhase)
+		double seconds[metricPhaseCount];
+
+		// Fitness functions run, and scores updated from changed partitions instead
+		unsigned long long int evaluations;
+		unsigned long long int fitnessUpdates;
+		// Scores found and not found in the fitness cache
+		unsigned long long int cacheHits;
+		unsigned long long int cacheMisses;
+		// Chromos encoded and decoded
+		unsigned long long int encodes;
+		unsigned long long int decodes;
+		// Chromos mutated, and the encoded bytes covered by their mutations
+		unsigned long long int mutatedChromos;
+		unsigned long long int mutatedBytes;
+		// Heap allocations during advanceGeneration()
+		// Only counted when GA_COUNT_ALLOCATIONS is also defined (see AllocationCounter.h)
+		unsigned long long int allocations;
+
+		GenerationMetrics()
+		{
+			reset();
+		};
+
+		void reset();
+		double getSeconds(const MetricPhase) const;
+		GenerationMetrics& operator+=(const GenerationMetrics&);
+
+		friend std::ostream& operator<<(std::ostream&, const GenerationMetrics&);
+	};
+
+	/**
+	*	@brief  Sets every time and counter to 0.
+	*
+	*	@return void
+	*/
+	inline void GenerationMetrics::reset()
+	{
+		generations = 0;
+		for (std::size_t i{ 0 }; i < metricPhaseCount; ++i) {
+			seconds[i] = 0.0;
+		}
+		evaluations = 0;
+		fitnessUpdates = 0;
+		cacheHits = 0;
+		cacheMisses = 0;
+		encodes = 0;
+		decodes = 0;
+		mutatedChromos = 0;
+		mutatedBytes = 0;
+		allocations = 0;
+	}
+
+	/**
+	*	@brief  Returns the wall time of a phase.
+	*
+	*	@param  t_phase specifies the phase
+	*	@return Time in seconds
+	*/
+	inline double GenerationMetrics::getSeconds(const MetricPhase t_phase) const
+	{
+		return seconds[static_cast<std::size_t>(t_phase)];
+	}
+
+	/**
+	*	@brief  Adds the times and counters of another set of metrics to these.
+	*
+	*	@param  t_other specifies the metrics to add
+	*	@return Reference to these metrics
+	*/
+	inline GenerationMetrics& GenerationMetrics::operator+=(const GenerationMetrics& t_other)
+	{
+		generations += t_other.generations;
+		for (std::size_t i{ 0 }; i < metricPhaseCount; ++i) {
+			seconds[i] += t_other.seconds[i];
+		}
+		evaluations += t_other.evaluations;
+		fitnessUpdates += t_other.fitnessUpdates;
+		cacheHits += t_other.cacheHits;
+		cacheMisses += t_other.cacheMisses;
+		encodes += t_other.encodes;
+		decodes += t_other.decodes;
+		mutatedChromos += t_other.mutatedChromos;
+		mutatedBytes += t_other.mutatedBytes;
+		allocations += t_other.allocations;
+		return *this;
+	}
+
+	/**
+	*	@brief  This is an operator overload that allows the metrics to be printed.
+	*	Times are printed in microseconds.
+	*
+	*	@param  t_output is the output stream
+	*	@param  self is the reference to these metrics
+	*	@return Output stream
+	*/
+	inline std::ostream& operator<<(std::ostream& t_output, const GenerationMetrics& self)
+	{
+		t_output << "Generations: " << self.generations << "\n";
+		for (std::size_t i{ 0 }; i < metricPhaseCount; ++i) {
+			t_output << getMetricPhaseName(static_cast<MetricPhase>(i)) << ": " << self.seconds[i] * 1000000.0 << " us\n";
+		}
+		t_output << "evaluations: " << self.evaluations << "\n";
+		t_output << "fitnessUpdates: " << self.fitnessUpdates << "\n";
+		t_output << "cacheHits: " << self.cacheHits << "\n";
+		t_output << "cacheMisses: " << self.cacheMisses << "\n";
+		t_output << "encodes: " << self.encodes << "\n";
+		t_output << "decodes: " << self.decodes << "\n";
+		t_output << "mutatedChromos: " << self.mutatedChromos << "\n";
+		t_output << "mutatedBytes: " << self.mutatedBytes << "\n";
+		t_output << "allocations: " << self.allocations << "\n";
+		return t_output;
+	}
+
+	// Adds the time between its construction and destruction to a phase
+	class MetricTimer
+	{
+	public:
+		explicit MetricTimer(GenerationMetrics& t_metrics, const MetricPhase t_phase)
+			: m_seconds(t_metrics.seconds[static_cast<std::size_t>(t_phase)]),
+			m_start(std::chrono::steady_clock::now())
+		{};
+		~MetricTimer()
+		{
+			m_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+		};
+
+		MetricTimer(const MetricTimer&) = delete;
+		MetricTimer& operator=(const MetricTimer&) = delete;
+
+	private:
+		double& m_seconds;
+		std::chrono::steady_clock::time_point m_start;
+	};
+
+} // namespace ga
+
+// Record metrics only when enabled
+// GA_METRIC_TIMER times the rest of the enclosing scope
+#ifdef GA_ENABLE_METRICS
+#define GA_METRIC_TIMER(t_metrics, t_phase) ga::MetricTimer gaMetricTimer_##t_phase((t_metrics), ga::MetricPhase::t_phase)
+#define GA_METRIC_ADD(t_metrics, t_counter, t_amount) ((t_metrics).t_counter += (t_amount))
+#else
+#define GA_METRIC_TIMER(t_metrics, t_phase) ((void)0)
+#define GA_METRIC_ADD(t_metrics, t_counter, t_amount) ((void)sizeof(t_amount))
+#endif	// GA_ENABLE_METRICS
+
+#endif	// GENERATION_METRICS_H_
@@ -21,38 +21,63 @@
 #include <random>
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <limits>
+#include <cmath>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 
 #include "GeneticAlgorithmTechniques.h"
 #include "ChromoSerialization.h"
+#include "ThreadPool.h"
+#include "FitnessCache.h"
+#include "PopulationBuffer.h"
+#include "RandomGenerator.h"
+#include "AliasTable.h"
+#include "ScoreSelection.h"
+#include "GenerationMetrics.h"
+#include "Checkpoint.h"
+#include "CheckpointWriter.h"
+#include "CSVWriter.h"
 
 namespace ga
 {
+	// Files written by writeToFileAsBinary() start with "GABINRY" and a 0, then this version.
+	// Files without them are from before the mutation chance was stored as a double.
+	const char binaryFileMagic[8]{ 'G', 'A', 'B', 'I', 'N', 'R', 'Y', '\0' };
+	const std::uint32_t binaryFileVersion{ 2 };
+
 	template <typename C>
 	class GeneticAlgorithm
 	{
 	public:
-		explicit GeneticAlgorithm(const std::string t_name, const std::size_t t_generationSize, const int t_initialStateId, int (*t_randomGenerator)(void))
+		explicit GeneticAlgorithm(const std::string t_name, const std::size_t t_generationSize, const int t_initialStateId, const RandomGenerator t_randomGenerator)
 			: m_name(t_name),
 			m_generationSize(t_generationSize),
 			m_randomGenerator(t_randomGenerator),
 			m_mutationSelection(MutationSelection::pureRandom),
 			m_mutationCountMax(0),
 			m_mutationBitWidth(8),
-			m_mutationChanceIn100(100),
+			m_mutationChance(1.0),
 			m_numCrossoverSplits(1),
 			m_currentGeneration(0)
 		{
+			// Partitions come first, as Chromos that track changes need them
+			C::getEncodedPartitions(m_encodedPartitions, m_mutationLimits);
 			for (std::size_t i = 0; i < t_generationSize; i++) {
-				m_chromo.push_back(new C(t_initialStateId, m_randomGenerator));
+				m_chromo.push_back(createChromo(t_initialStateId));
 			}
-			C::getEncodedPartitions(m_encodedPartitions, m_mutationLimits);
 		};
 
 		~GeneticAlgorithm()
 		{
 			// Cleanup
+			unbindPopulation();
 			for (auto p : m_chromo)
 				delete p;
+			for (auto p : m_offspring)
+				delete p;
 			for (auto p : m_competition)
 				delete p;
 		};
@@ -70,22 +95,68 @@ namespace ga
 		// Algorithm settings
 		void setMutationSelection(const MutationSelection);
 		void setMutationCountMax(const std::size_t);
-		void setMutationCountFunction(std::size_t(*)(const std::size_t, const double, int(*)(void)));
+		void setMutationCountFunction(std::size_t(*)(const std::size_t, const double, RandomGenerator&));
 		void setMutationBitWidth(const std::size_t);
+		void setMutationChance(const double);
 		void setMutationChanceIn100(const short int);
 		void setNumberToCopy(const std::size_t);
 		void setNumberToShuffle(const std::size_t);
 		void setNumberToCrossover(const std::size_t);
 		void setNumberToMutate(const std::size_t);
 		void setNumberOfCrossoverSplits(const std::size_t);
+		void setShuffleMode(const ShuffleMode);
+		void setParentSelection(const ParentSelection);
+		void setTournamentSize(const std::size_t);
+		void setTruncationCount(const std::size_t);
+
+		// Parallel settings
+		void setThreadCount(const std::size_t);
+		void setParallelChunkSize(const std::size_t);
+		void setParallelFitness(const bool);
+		void setParallelSelection(const bool);
+		ThreadPool* getThreadPool();
+
+		// Fitness cache settings
+		void setFitnessCacheSize(const std::size_t);
+		unsigned long long int getFitnessCacheHits() const;
+		unsigned long long int getFitnessCacheMisses() const;
+		unsigned long long int getFitnessEvaluationCount() const;
+		unsigned long long int getFitnessUpdateCount() const;
+
+		// Storage settings
+		void setContiguousStorage(const bool);
+		bool isContiguousStorage() const;
+		void setDoubleBuffering(const bool);
+		bool isDoubleBuffered() const;
 
 		unsigned long int getGeneration() const;
 
+		// Metrics (only recorded when GA_ENABLE_METRICS is defined)
+		const GenerationMetrics& getMetrics() const;
+		const GenerationMetrics& getTotalMetrics() const;
+		void resetMetrics();
+
+		// Migration between GAs (see IslandModel.h)
+		void getTopEncodings(std::vector<std::string>&, const std::size_t) const;
+		void importMigrants(const std::vector<std::string>&);
+
 		// File I/O
 		void writeToFileAsBinary(const std::string);
 		void readFromFileAsBinary(const std::string);
 		void writeToFileAsCSV(const std::string);
 		void readFromFileAsCSV(const std::string);
+		bool writeCheckpoint(const std::string);
+		bool readCheckpoint(const std::string, const bool = true);
+
+		// Background checkpoints (see CheckpointWriter.h)
+		void setCheckpointPolicy(const std::string, const unsigned long int, const double = 0.0, const std::size_t = 0);
+		void waitForCheckpoints();
+		const CheckpointWriter* getCheckpointWriter() const;
+
+		// A CSV row for every generation (see CSVWriter.h)
+		bool setHistoryFile(const std::string, const std::size_t = 1, const bool = true);
+		void flushHistory();
+		CSVWriter* getHistoryWriter();
 
 		// Print to console
 		friend std::ostream &operator<<(std::ostream& output, const GeneticAlgorithm& self) {
@@ -121,8 +192,8 @@ namespace ga
 		// Each mutation modifies a block of bits of this width
 		std::size_t m_mutationBitWidth;
 		// Within mutation blocks, this controls the
-		// chance of any bit being toggled
-		short int m_mutationChanceIn100;
+		// chance of any bit being toggled, in (0, 1]
+		double m_mutationChance;
 
 		// Variables which control the number of
 		// Chromos to run different crossover processes on
@@ -137,6 +208,25 @@ namespace ga
 		// this many times
 		std::size_t m_numCrossoverSplits{ 1 };
 
+		// In a shuffle, choose each byte or each bit
+		// from a random parent
+		ShuffleMode m_shuffleMode{ ShuffleMode::byte };
+
+		// Controls how parents are chosen for copies, shuffles and crossovers
+		ParentSelection m_parentSelection{ ParentSelection::uniformElite };
+		// Number of Chromos drawn for each tournament
+		std::size_t m_tournamentSize{ 2 };
+		// Number of top Chromos used as parents by truncation selection
+		// (0 uses every Elite Chromo)
+		std::size_t m_truncationCount{ 0 };
+		// Parents are chosen from Chromos [0, m_numParents)
+		// Recalculated each generation
+		std::size_t m_numParents{ 0 };
+		// Weights and alias table for roulette and rank selection
+		// Built once per generation, reused each generation
+		std::vector<double> m_selectionWeights;
+		AliasTable m_selectionTable;
+
 		// Number of Chromos to mutate
 		std::size_t m_numEvolveMutate{ 0 };
 
@@ -148,15 +238,92 @@ namespace ga
 
 		unsigned long int m_currentGeneration{ 0 };
 
+		// Times and counters of the last generation,
+		// and of every generation since resetMetrics()
+		GenerationMetrics m_metrics;
+		GenerationMetrics m_totalMetrics;
+
+		// Worker threads, created once and reused every generation
+		// Only created when a parallel setting is enabled
+		std::unique_ptr<ThreadPool> m_threadPool;
+		// Number of threads in the pool (0 uses the hardware thread count)
+		std::size_t m_threadCount{ 0 };
+		// Number of Chromos handed to a thread at a time
+		std::size_t m_parallelChunkSize{ 64 };
+		// Run fitness functions on the thread pool
+		bool m_isParallelFitness{ false };
+		// Find the top scoring Chromos on the thread pool
+		bool m_isParallelSelection{ false };
+
+		// Scores of recently seen encoded strings
+		// Only created when setFitnessCacheSize() is called
+		std::unique_ptr<FitnessCache> m_fitnessCache;
+		// Number of times a fitness function has been run
+		unsigned long long int m_fitnessEvaluationCount{ 0 };
+		// Number of scores updated from changed partitions (see C::updateFitness())
+		unsigned long long int m_fitnessUpdateCount{ 0 };
+		// Chromos needing their fitness function run this generation,
+		// and their encoding hashes (reused each generation)
+		std::vector<C*> m_evaluationList;
+		std::vector<std::uint64_t> m_evaluationHashes;
+		// Chromos still needing a full fitness function after updates (reused each generation)
+		std::vector<C*> m_fullEvaluationList;
+
+		// Writes checkpoints on its own thread
+		// Only created when setCheckpointPolicy() is called
+		std::unique_ptr<CheckpointWriter> m_checkpointWriter;
+		std::string m_checkpointFilename;
+		// A checkpoint is taken after this many generations,
+		// or this many seconds, since the last one (0 disables either)
+		unsigned long int m_checkpointGenerationInterval{ 0 };
+		double m_checkpointSecondsInterval{ 0.0 };
+		unsigned long int m_lastCheckpointGeneration{ 0 };
+		std::chrono::steady_clock::time_point m_lastCheckpointTime;
+
+		// Adds a row to the history file each generation
+		// Only created when setHistoryFile() is called
+		std::unique_ptr<CSVWriter> m_historyWriter;
+		// Number of top Chromos written in each history row
+		std::size_t m_historyChromoCount{ 1 };
+		// Score of each Chromo, used to find the top Chromos (reused each generation)
+		std::vector<ScoreKey> m_historyKeys;
+
+		// Encoded data and scores for the whole generation in contiguous memory
+		// Only allocated when setContiguousStorage() is called
+		PopulationBuffer m_population;
+		bool m_isContiguousStorage{ false };
+		// Chromos in slot order, which never changes
+		std::vector<C*> m_slotChromo;
+		// The slot of each Chromo in m_chromo, reordered along with m_chromo
+		std::vector<std::size_t> m_chromoSlots;
+
+		// Offspring are written here during the crossover phase, then swapped
+		// with m_chromo, so that no parent is overwritten while it is in use
+		// Only created when setDoubleBuffering() is called
+		std::vector<C*> m_offspring;
+		bool m_isDoubleBuffered{ false };
+		// The slot of each Chromo in m_offspring, when contiguous storage is enabled
+		std::vector<std::size_t> m_offspringSlots;
+
+		// Chromos picked for mutation (reused each generation)
+		std::vector<std::size_t> m_mutationList;
+
+		// Score of each Chromo, used to find the top scoring Chromos,
+		// and the reordered Chromos and slots (reused each generation)
+		std::vector<ScoreKey> m_scoreKeys;
+		std::vector<C*> m_orderedChromo;
+		std::vector<std::size_t> m_orderedSlots;
+
 	private:
 		// Evolution phases
+		void runGeneration(const bool);
 		bool runSelectionPhase(const bool);
 		void runCrossoverPhase(const bool);
 		void runMutationPhase(const bool);
 		
 		// Selection processes:
 		void getFitnessScores();
-		void sortChromoByScore();
+		void selectTopChromos();
 		
 		// Helper functions:
 		
@@ -171,6 +338,13 @@ namespace ga
 		void determineEliteChromos();
 		// Calculate indices for crossover + mutation processes
 		void determineEvolutionRanges();
+		// Number of top Chromos to select, and whether
+		// they must be in score order
+		std::size_t determineTopCount() const;
+		bool isScoreOrderNeeded() const;
+		// Find the Chromos that may be parents, and build
+		// any table needed to choose between them
+		void determineParents();
 
 		// Crossover processes:
 		void doCopies();
@@ -181,10 +355,34 @@ namespace ga
 		void doMutations();
 		void doCustomMutations();
 
+		// Encode or decode a single Chromo, only if it has changed
+		void encodeChromo(C*);
+		void decodeChromo(C*);
+
+		// Checkpoint helpers
+		bool prepareCheckpoint(std::size_t&);
+		void takeCheckpointSnapshot(CheckpointSnapshot&, const std::size_t);
+		void runCheckpointPolicy();
+
+		// CSV helpers
+		void writeCSVChromoHeader(bif::CSVBuffer&, const std::string) const;
+		void writeHistoryRow();
+
+		// Storage helpers
+		C* createChromo(const int);
+		void resizeGeneration(const std::size_t);
+		bool bindPopulation();
+		void unbindPopulation();
+		C* getOffspring(const std::size_t);
+		void swapGenerations();
+
 		// Utility functions
 		std::size_t pickRandomVolatileChromo();
 		std::size_t pickRandomEliteChromo();
 		void pickTwoRandomEliteChromos(std::size_t&, std::size_t&);
+		std::size_t pickParent();
+		void pickTwoParents(std::size_t&, std::size_t&);
+		std::size_t pickTournamentWinner();
 
 		// Information about encoded string partitions
 		std::vector<EncodedPartition> m_encodedPartitions;
@@ -197,7 +395,8 @@ namespace ga
 		std::string m_name;
 
 		// Random number generator
-		int (*m_randomGenerator)(void);
+		// Used for GA-level choices, such as picking parents
+		RandomGenerator m_randomGenerator;
 	};
 
 
@@ -207,11 +406,35 @@ namespace ga
 	/**
 	*	@brief  Calls methods in order to perform selection, crossover, and mutation.
 	*	Also handles errors due to incorrect bounds.
+	*	If GA_ENABLE_METRICS is defined, the time of each phase is
+	*	recorded along with counters such as fitness evaluations (see getMetrics()).
 	*
 	*	@return void
 	*/
 	template <typename C>
 	void GeneticAlgorithm<C>::advanceGeneration(const bool showDebugMessages)
+	{
+#ifdef GA_ENABLE_METRICS
+		m_metrics.reset();
+		const unsigned long long int allocationCount{ AllocationCounter::getCount() };
+		{
+			GA_METRIC_TIMER(m_metrics, total);
+			runGeneration(showDebugMessages);
+		}
+		m_metrics.allocations = AllocationCounter::getCount() - allocationCount;
+		m_totalMetrics += m_metrics;
+#else
+		runGeneration(showDebugMessages);
+#endif	// GA_ENABLE_METRICS
+	}
+
+	/**
+	*	@brief  Runs each phase of advanceGeneration().
+	*
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::runGeneration(const bool showDebugMessages)
 	{
 		// Preparation phase
 		if (!areBoundsValid()) {
@@ -230,6 +453,14 @@ namespace ga
 			std::cout << "Selection phase complete...\n";
 		}
 
+		// Every Chromo has a score, so this is the best time for a checkpoint
+		if (m_historyWriter) {
+			writeHistoryRow();
+		}
+		if (m_checkpointWriter) {
+			runCheckpointPolicy();
+		}
+
 		// Crossover phase
 		runCrossoverPhase(showDebugMessages);
 		if (showDebugMessages) {
@@ -243,13 +474,14 @@ namespace ga
 		}
 
 		m_currentGeneration++;
+		GA_METRIC_ADD(m_metrics, generations, 1);
 	}
 	
 	/**
 	*	@brief  Outputs GA settings and Chromo data to specified file.
 	*	The Chromo data written is the encoded string data, not the actual
-	*	variables. Therefore, the Chromo's encode() function must be
-	*	called before this function is called.
+	*	variables. Any Chromos changed since they were last encoded
+	*	are encoded first.
 	*	
 	*	@param  t_filename specifies the path and filename of the output file
 	*	@return void
@@ -257,6 +489,8 @@ namespace ga
 	template <typename C>
 	void GeneticAlgorithm<C>::writeToFileAsBinary(const std::string t_filename)
 	{
+		encodeChromos();
+
 		// Attempt to open file
 		std::ofstream oStream(t_filename, std::ios::out | std::ios::binary);
 
@@ -264,11 +498,16 @@ namespace ga
 		{
 			int tempInt;
 
+			// Write file format
+			oStream.write(binaryFileMagic, sizeof(binaryFileMagic));
+			oStream.write((char*)&binaryFileVersion, sizeof(std::uint32_t));
+
 			// Write GA settings
 			oStream.write((char*)&m_generationSize, sizeof(std::size_t));
 			oStream.write((char*)&m_mutationCountMax, sizeof(std::size_t));
 			oStream.write((char*)&m_mutationBitWidth, sizeof(std::size_t));
-			oStream.write((char*)&m_mutationChanceIn100, sizeof(std::size_t));
+			const double mutationChanceIn100{ m_mutationChance * 100.0 };
+			oStream.write((char*)&mutationChanceIn100, sizeof(double));
 			oStream.write((char*)&m_numEvolveCopy, sizeof(std::size_t));
 			oStream.write((char*)&m_numEvolveShuffle, sizeof(std::size_t));
 			oStream.write((char*)&m_numEvolveCrossover, sizeof(std::size_t));
@@ -293,7 +532,8 @@ namespace ga
 	/**
 	*	@brief  Opens file and reads GA settings and Chromo data. Then decodes Chromo data.
 	*	Since the Chromo data in the file has been encoded to string format,
-	*	this method decodes it.
+	*	this method decodes it. Files from before the format was versioned
+	*	are still read, and files from newer versions are rejected.
 	*
 	*	@param  t_filename specifies the path and filename of the file to read from
 	*	@return void
@@ -306,6 +546,25 @@ namespace ga
 		
 		if (iStream.is_open())
 		{
+			// Read file format
+			char magic[sizeof(binaryFileMagic)]{};
+			iStream.seekg(0, std::ios::beg);
+			iStream.read(magic, sizeof(magic));
+			const bool isVersioned{ std::memcmp(magic, binaryFileMagic, sizeof(magic)) == 0 };
+			if (isVersioned)
+			{
+				std::uint32_t version{ 0 };
+				iStream.read((char*)&version, sizeof(std::uint32_t));
+				if (version != binaryFileVersion) {
+					std::cout << "\nERROR: " << t_filename << " has binary file version " << version << ", only version " << binaryFileVersion << " can be read\n\n";
+					return;
+				}
+			}
+			else {
+				// Unversioned files start straight with the GA settings
+				iStream.seekg(0, std::ios::beg);
+			}
+
 			// Temporary vars
 			int tempInt;
 			std::size_t newGenerationSize;
@@ -313,13 +572,11 @@ namespace ga
 			char * readMemSizeT;
 			char * readMemInt;
 			char * readMemULongInt;
-			memSize = sizeof(std::size_t);
+			const std::size_t memSize{ sizeof(std::size_t) };
 			readMemSizeT = new char[memSize];
 			readMemInt = new char[sizeof(int)];
 			readMemULongInt = new char[sizeof(unsigned long int)];
 
-
-			iStream.seekg(0, ios::beg);
 			iStream.read(readMemSizeT, memSize);
 			newGenerationSize = *((std::size_t*) readMemSizeT);
 
@@ -329,8 +586,20 @@ namespace ga
 			iStream.read(readMemSizeT, memSize);
 			m_mutationBitWidth = *((std::size_t*)readMemSizeT);
 
-			iStream.read(readMemSizeT, memSize);
-			m_mutationChanceIn100 = *((std::size_t*)readMemSizeT);
+			if (isVersioned)
+			{
+				double mutationChanceIn100;
+				iStream.read((char*)&mutationChanceIn100, sizeof(double));
+				m_mutationChance = mutationChanceIn100 / 100.0;
+			}
+			else
+			{
+				// Stored as the bytes of a short int out of 100, padded to a std::size_t
+				short int mutationChanceIn100;
+				iStream.read(readMemSizeT, memSize);
+				std::memcpy(&mutationChanceIn100, readMemSizeT, sizeof(short int));
+				m_mutationChance = mutationChanceIn100 / 100.0;
+			}
 
 			iStream.read(readMemSizeT, memSize);
 			m_numEvolveCopy = *((std::size_t*)readMemSizeT);
@@ -353,8 +622,7 @@ namespace ga
 
 			// Apply GA setting - Generation Size
 			if (m_generationSize != newGenerationSize) {
-				m_generationSize = newGenerationSize;
-				m_chromo.resize(m_generationSize, new C(0, m_randomGenerator));
+				resizeGeneration(newGenerationSize);
 			}
 			
 			delete[] readMemSizeT;
@@ -367,10 +635,9 @@ namespace ga
 				// Read encoded data
 				(*it)->readFromFileAsBinary(iStream);
 				// Translate to variables and limit
-				(*it)->decode();
-				(*it)->applyLimits();
+				decodeChromo(*it);
 				// Encode again, in case limits were applied
-				(*it)->encode();
+				encodeChromo(*it);
 			}
 
 			iStream.close();
@@ -379,10 +646,352 @@ namespace ga
 		else std::cout << "\nERROR: Unable to open file " + t_filename + "\n\n";
 	}
 
+	/**
+	*	@brief  Writes a checkpoint of the GA (see Checkpoint.h), and waits until it is written.
+	*	The checkpoint holds every Chromo's encoded data and score, the
+	*	GA settings, the generation, and the GA's random state, so a run
+	*	can be continued with readCheckpoint(). Any Chromos changed since
+	*	they were last encoded are encoded first. Chromos without a
+	*	score are saved with a NaN score, and are scored again once read.
+	*	To write checkpoints without waiting, see setCheckpointPolicy().
+	*
+	*	@param  t_filename specifies the path and filename of the checkpoint
+	*	@return true if the checkpoint was written, false otherwise
+	*/
+	template <typename C>
+	bool GeneticAlgorithm<C>::writeCheckpoint(const std::string t_filename)
+	{
+		std::size_t encodedBytes;
+		if (!prepareCheckpoint(encodedBytes)) {
+			return false;
+		}
+
+		CheckpointSnapshot snapshot;
+		takeCheckpointSnapshot(snapshot, encodedBytes);
+		std::vector<std::uint64_t> slotHashes;
+		return writeCheckpointFile(snapshot, t_filename, slotHashes);
+	}
+
+	/**
+	*	@brief  Reads a checkpoint written by writeCheckpoint(), then decodes each Chromo.
+	*	The file is mapped into memory, and each Chromo's encoded data is
+	*	copied straight from the mapping into the Chromo's storage. Saved
+	*	scores are restored, so Chromos are not scored again. The GA's
+	*	random stream continues from where it was saved, but each Chromo
+	*	keeps its own random stream. If the checkpoint was written by a
+	*	different Chromo class, or is damaged, nothing is changed.
+	*
+	*	@param  t_filename specifies the path and filename of the checkpoint
+	*	@param  t_isDataChecked specifies whether to check the data against its checksum first
+	*	@return true if the checkpoint was read, false otherwise
+	*/
+	template <typename C>
+	bool GeneticAlgorithm<C>::readCheckpoint(const std::string t_filename, const bool t_isDataChecked)
+	{
+		CheckpointReader reader;
+		if (!reader.open(t_filename, t_isDataChecked, m_threadPool.get())) {
+			return false;
+		}
+
+		const CheckpointHeader& header{ reader.getHeader() };
+		if (header.schemaHash != hashEncodedPartitions(m_encodedPartitions, m_mutationLimits)) {
+			std::cout << "\nERROR: Checkpoint " + t_filename + " was written by a different Chromo class\n\n";
+			return false;
+		}
+
+		// Apply GA setting - Generation Size
+		if (m_generationSize != reader.getChromoCount()) {
+			resizeGeneration(reader.getChromoCount());
+		}
+
+		m_currentGeneration = static_cast<unsigned long int>(header.generation);
+		m_lastCheckpointGeneration = m_currentGeneration;
+		m_numEvolveCopy = static_cast<std::size_t>(header.numEvolveCopy);
+		m_numEvolveShuffle = static_cast<std::size_t>(header.numEvolveShuffle);
+		m_numEvolveCrossover = static_cast<std::size_t>(header.numEvolveCrossover);
+		m_numEvolveMutate = static_cast<std::size_t>(header.numEvolveMutate);
+		m_numCrossoverSplits = static_cast<std::size_t>(header.numCrossoverSplits);
+		m_mutationCountMax = static_cast<std::size_t>(header.mutationCountMax);
+		m_mutationBitWidth = static_cast<std::size_t>(header.mutationBitWidth);
+		m_mutationChance = header.mutationChance;
+		m_mutationSelection = static_cast<MutationSelection>(header.mutationSelection);
+		m_shuffleMode = static_cast<ShuffleMode>(header.shuffleMode);
+		m_parentSelection = static_cast<ParentSelection>(header.parentSelection);
+		m_tournamentSize = static_cast<std::size_t>(header.tournamentSize);
+		m_truncationCount = static_cast<std::size_t>(header.truncationCount);
+
+		if (header.randomEngine == static_cast<std::uint32_t>(m_randomGenerator.getEngine())) {
+			m_randomGenerator.setState(header.randomState);
+		}
+		else {
+			std::cout << "\nWARNING: Checkpoint " + t_filename + " used a different random engine, so its random stream was not restored\n\n";
+		}
+
+		// Read each Chromo
+		for (std::size_t i{ 0 }; i < m_generationSize; ++i)
+		{
+			C* chromo{ m_chromo[i] };
+			chromo->setEncoding(reader.getEncoding(i), reader.getEncodedBytes());
+			// Translate to variables and limit
+			decodeChromo(chromo);
+			// Encode again, in case limits were applied
+			encodeChromo(chromo);
+
+			const double score{ reader.getScore(i) };
+			if (!std::isnan(score)) {
+				chromo->restoreScore(score);
+			}
+		}
+		return true;
+	}
+
+	/**
+	*	@brief  Writes checkpoints in the background, every few generations or seconds.
+	*	When a checkpoint is due, the Chromos are copied into a snapshot
+	*	during advanceGeneration(), once every Chromo has been scored. The
+	*	snapshot is written on the CheckpointWriter's thread, to a
+	*	temporary file which then replaces the checkpoint, so evolution
+	*	carries on while it is written. Load it with readCheckpoint().
+	*
+	*	If the pending snapshots would go over t_memoryLimit, the
+	*	checkpoint is put off until the next generation. One snapshot is
+	*	always allowed, so 0 keeps at most one in memory.
+	*
+	*	@param  t_filename specifies the path and filename of the checkpoint
+	*	@param  t_generationInterval specifies the generations between checkpoints (0 to only use seconds)
+	*	@param  t_secondsInterval specifies the seconds between checkpoints (0 to only use generations)
+	*	@param  t_memoryLimit specifies the bytes pending snapshots may hold
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setCheckpointPolicy(const std::string t_filename, const unsigned long int t_generationInterval, const double t_secondsInterval, const std::size_t t_memoryLimit)
+	{
+		m_checkpointFilename = t_filename;
+		m_checkpointGenerationInterval = t_generationInterval;
+		m_checkpointSecondsInterval = t_secondsInterval > 0.0 ? t_secondsInterval : 0.0;
+		m_lastCheckpointGeneration = m_currentGeneration;
+		m_lastCheckpointTime = std::chrono::steady_clock::now();
+
+		if (m_checkpointGenerationInterval == 0 && m_checkpointSecondsInterval == 0.0) {
+			// Pending checkpoints are written before the writer is destroyed
+			m_checkpointWriter.reset();
+			return;
+		}
+		if (!m_checkpointWriter) {
+			m_checkpointWriter.reset(new CheckpointWriter());
+		}
+		m_checkpointWriter->setMemoryLimit(t_memoryLimit);
+	}
+
+	/**
+	*	@brief  Blocks until every background checkpoint taken so far has been written.
+	*
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::waitForCheckpoints()
+	{
+		if (m_checkpointWriter) {
+			m_checkpointWriter->waitUntilIdle();
+		}
+	}
+
+	/**
+	*	@brief  Returns the background checkpoint writer, such as to read how many checkpoints were written.
+	*
+	*	@return Pointer to the writer, or nullptr if setCheckpointPolicy() has not enabled it
+	*/
+	template <typename C>
+	const CheckpointWriter* GeneticAlgorithm<C>::getCheckpointWriter() const
+	{
+		return m_checkpointWriter.get();
+	}
+
+	/**
+	*	@brief  Adds a row to a CSV file every generation: the generation, best and mean scores, and the top Chromos.
+	*	Rows are written after the selection phase, when every Chromo has a
+	*	score. The file is kept open, and rows are buffered (see CSVWriter.h),
+	*	so call flushHistory() to see the latest rows in the file. A header
+	*	row is written first, unless rows are added to an existing file.
+	*
+	*	@param  t_filename specifies the path and filename of the history file (an empty name closes it)
+	*	@param  t_chromoCount specifies the number of top Chromos written in each row, best first
+	*	@param  t_isAppending specifies whether to add to the end of an existing file, rather than replace it
+	*	@return true if the file was opened, false otherwise
+	*/
+	template <typename C>
+	bool GeneticAlgorithm<C>::setHistoryFile(const std::string t_filename, const std::size_t t_chromoCount, const bool t_isAppending)
+	{
+		m_historyWriter.reset();
+		if (t_filename.empty()) {
+			return true;
+		}
+
+		std::unique_ptr<CSVWriter> writer{ new CSVWriter() };
+		if (!writer->open(t_filename, t_isAppending)) {
+			// Error message has already been displayed
+			return false;
+		}
+		m_historyChromoCount = t_chromoCount;
+
+		if (writer->isNewFile())
+		{
+			bif::CSVBuffer& buffer{ writer->getBuffer() };
+			buffer.writeText("Generation,Best,Mean");
+			for (std::size_t i{ 0 }; i < m_historyChromoCount; ++i)
+			{
+				const std::string prefix{ "Top" + std::to_string(i) + "." };
+				buffer.writeText(prefix + "ID," + prefix + "Score");
+				writeCSVChromoHeader(buffer, prefix);
+			}
+			writer->endLine();
+		}
+		m_historyWriter = std::move(writer);
+		return true;
+	}
+
+	/**
+	*	@brief  Writes every buffered history row to the history file.
+	*
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::flushHistory()
+	{
+		if (m_historyWriter) {
+			m_historyWriter->flush();
+		}
+	}
+
+	/**
+	*	@brief  Returns the history file writer, for settings such as the buffer size.
+	*
+	*	@return Pointer to the writer, or nullptr if setHistoryFile() has not opened a file
+	*/
+	template <typename C>
+	CSVWriter* GeneticAlgorithm<C>::getHistoryWriter()
+	{
+		return m_historyWriter.get();
+	}
+
+	/**
+	*	@brief  Encodes every Chromo, and checks that they can be saved in a checkpoint.
+	*
+	*	@param  t_encodedBytes is set to the encoded length of every Chromo
+	*	@return true if every Chromo has the same encoded length, false otherwise
+	*/
+	template <typename C>
+	bool GeneticAlgorithm<C>::prepareCheckpoint(std::size_t& t_encodedBytes)
+	{
+		encodeChromos();
+
+		t_encodedBytes = m_generationSize > 0 ? m_chromo.front()->getEncodedData().length() : 0;
+		for (std::size_t i{ 0 }; i < m_generationSize; ++i)
+		{
+			if (m_chromo[i]->getEncodedData().length() != t_encodedBytes) {
+				std::cout << "\nERROR: Checkpoints need every Chromo to have the same encoded length\n\n";
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	*	@brief  Copies the GA settings, random state, and every encoded Chromo and score into a snapshot.
+	*	The snapshot's buffers are reused, so taking a snapshot into a
+	*	snapshot of the same size does not allocate memory. With a
+	*	thread pool, the Chromos are copied on every thread.
+	*
+	*	@param  t_snapshot is filled with the GA's current state
+	*	@param  t_encodedBytes specifies the encoded length of every Chromo (see prepareCheckpoint())
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::takeCheckpointSnapshot(CheckpointSnapshot& t_snapshot, const std::size_t t_encodedBytes)
+	{
+		CheckpointHeader& header{ t_snapshot.header };
+		initializeCheckpointHeader(header, m_generationSize, t_encodedBytes);
+		header.schemaHash = hashEncodedPartitions(m_encodedPartitions, m_mutationLimits);
+		header.generation = m_currentGeneration;
+		header.randomEngine = static_cast<std::uint32_t>(m_randomGenerator.getEngine());
+		m_randomGenerator.getState(header.randomState);
+		header.numEvolveCopy = m_numEvolveCopy;
+		header.numEvolveShuffle = m_numEvolveShuffle;
+		header.numEvolveCrossover = m_numEvolveCrossover;
+		header.numEvolveMutate = m_numEvolveMutate;
+		header.numCrossoverSplits = m_numCrossoverSplits;
+		header.mutationCountMax = m_mutationCountMax;
+		header.mutationBitWidth = m_mutationBitWidth;
+		header.mutationChance = m_mutationChance;
+		header.mutationSelection = static_cast<std::uint32_t>(m_mutationSelection);
+		header.shuffleMode = static_cast<std::uint32_t>(m_shuffleMode);
+		header.parentSelection = static_cast<std::uint32_t>(m_parentSelection);
+		header.tournamentSize = m_tournamentSize;
+		header.truncationCount = m_truncationCount;
+
+		// Each slot is zero padded to the stride
+		const std::size_t stride{ static_cast<std::size_t>(header.stride) };
+		t_snapshot.encodings.resize(m_generationSize * stride);
+		t_snapshot.scores.resize(m_generationSize);
+
+		auto copyChromos = [this, &t_snapshot, stride, t_encodedBytes](const std::size_t t_first, const std::size_t t_last)
+		{
+			for (std::size_t i{ t_first }; i < t_last; ++i)
+			{
+				const C* chromo{ m_chromo[i] };
+				char* slot{ t_snapshot.encodings.data() + i * stride };
+				std::copy(chromo->getEncodedData().data(), chromo->getEncodedData().data() + t_encodedBytes, slot);
+				std::fill(slot + t_encodedBytes, slot + stride, 0);
+				t_snapshot.scores[i] = chromo->isScoreStale() ? std::numeric_limits<double>::quiet_NaN() : chromo->getScore();
+			}
+		};
+		if (m_threadPool) {
+			m_threadPool->parallelFor(m_generationSize, m_parallelChunkSize, copyChromos);
+		}
+		else {
+			copyChromos(static_cast<std::size_t>(0), m_generationSize);
+		}
+	}
+
+	/**
+	*	@brief  Hands a snapshot to the CheckpointWriter if a checkpoint is due.
+	*	If the writer refuses the snapshot (see setCheckpointPolicy()),
+	*	the checkpoint is tried again next generation.
+	*
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::runCheckpointPolicy()
+	{
+		const std::chrono::steady_clock::time_point now{ std::chrono::steady_clock::now() };
+		const bool isGenerationDue{ m_checkpointGenerationInterval > 0 && m_currentGeneration - m_lastCheckpointGeneration >= m_checkpointGenerationInterval };
+		const bool isTimeDue{ m_checkpointSecondsInterval > 0.0 && std::chrono::duration<double>(now - m_lastCheckpointTime).count() >= m_checkpointSecondsInterval };
+		if (!isGenerationDue && !isTimeDue) {
+			return;
+		}
+
+		std::size_t encodedBytes;
+		if (!prepareCheckpoint(encodedBytes)) {
+			return;
+		}
+		const std::size_t snapshotBytes{ m_generationSize * (PopulationBuffer::calculateStride(encodedBytes) + sizeof(double)) };
+		std::unique_ptr<CheckpointSnapshot> snapshot{ m_checkpointWriter->acquireSnapshot(snapshotBytes) };
+		if (!snapshot) {
+			return;
+		}
+
+		takeCheckpointSnapshot(*snapshot, encodedBytes);
+		m_checkpointWriter->submit(std::move(snapshot), m_checkpointFilename);
+		m_lastCheckpointGeneration = m_currentGeneration;
+		m_lastCheckpointTime = now;
+	}
+
 	/**
 	*	@brief  Outputs GA settings and Chromo data to specified CSV file.
 	*	As the actual Chromo variables are written, rather than the encoded strings,
-	*	the inherited Chromo method writeToFileAsCSV() is called.
+	*	the inherited Chromo method writeToCSVBuffer() is called. Any Chromos
+	*	changed since they were last decoded are decoded first. With a thread
+	*	pool, the Chromos are formatted on every thread (see CSVWriter::writeRows()).
 	*
 	*	@param  t_filename specifies the path and filename of the output file
 	*	@return void
@@ -390,53 +999,107 @@ namespace ga
 	template <typename C>
 	void GeneticAlgorithm<C>::writeToFileAsCSV(const std::string t_filename)
 	{
+		decodeChromos();
+
 		// Attempt to open file
-		std::ofstream oStream(t_filename, std::ios::out);
-		
-		if (oStream.is_open())
+		CSVWriter writer;
+		if (!writer.open(t_filename)) {
+			// Error message has already been displayed
+			return;
+		}
+		bif::CSVBuffer& buffer{ writer.getBuffer() };
+
+		// Write header for GA settings
+		buffer.writeText("CurrentGen,GenSize,MutateMax,MutateBitWi,MutateIn100,Copy,Shuffle,Crossover,Mutate,MutationSelect");
+		writer.endLine();
+
+		// Write GA settings
+		buffer.write(m_currentGeneration);
+		buffer.write(m_generationSize);
+		buffer.write(m_mutationCountMax);
+		buffer.write(m_mutationBitWidth);
+		buffer.write(m_mutationChance * 100.0);
+		buffer.write(m_numEvolveCopy);
+		buffer.write(m_numEvolveShuffle);
+		buffer.write(m_numEvolveCrossover);
+		buffer.write(m_numEvolveMutate);
+		buffer.write(static_cast<int>(m_mutationSelection));
+		writer.endLine();
+		writer.endLine();
+
+		// Write header for chromos
+		buffer.writeText("ChromoID,Score");
+		writeCSVChromoHeader(buffer, "");
+		writer.endLine();
+
+		// Write each Chromo
+		auto writeChromo = [this](const std::size_t t_id, bif::CSVBuffer& t_buffer)
 		{
-			// Write header for GA settings
-			oStream << "CurrentGen,GenSize,MutateMax,MutateBitWi,MutateIn100,Copy,Shuffle,Crossover,Mutate,MutationSelect\n";
+			m_chromo[t_id]->writeToCSVBuffer(t_id, t_buffer);
+		};
+		writer.writeRows(m_chromo.size(), writeChromo, m_threadPool.get(), m_parallelChunkSize);
 
-			// Write GA settings
-			oStream << m_currentGeneration << "," <<
-				m_generationSize << "," <<
-				m_mutationCountMax << "," <<
-				m_mutationBitWidth << "," <<
-				m_mutationChanceIn100 << "," <<
-				m_numEvolveCopy << "," <<
-				m_numEvolveShuffle << "," <<
-				m_numEvolveCrossover << "," <<
-				m_numEvolveMutate << "," <<
-				static_cast<int>(m_mutationSelection) <<
-				"\n\n";
-
-			// Write header for chromos
-			oStream << "ChromoID,Score";
-			for (std::size_t i{ 0 }; i < m_encodedPartitions.size(); ++i) {
-				if (m_encodedPartitions.at(i).type == EncodedPartitionType::eachBitUnique) {
-					// Boolean vectors require columns for each bit
-					for (std::size_t bit{ 0 }; bit < m_encodedPartitions.at(i).uniqueBits; ++bit) {
-						oStream << "," << m_encodedPartitions.at(i).name << bit;
-					}
-				}
-				else {
-					oStream << "," << m_encodedPartitions.at(i).name;
+		writer.close();
+	}
+
+	/**
+	*	@brief  Writes the CSV column name of each Chromo value. Bools have a column for each bit.
+	*
+	*	@param  t_buffer specifies the line to add the names to
+	*	@param  t_prefix specifies text added before each name
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::writeCSVChromoHeader(bif::CSVBuffer& t_buffer, const std::string t_prefix) const
+	{
+		for (std::size_t i{ 0 }; i < m_encodedPartitions.size(); ++i) {
+			if (m_encodedPartitions.at(i).type == EncodedPartitionType::eachBitUnique) {
+				// Boolean vectors require columns for each bit
+				for (std::size_t bit{ 0 }; bit < m_encodedPartitions.at(i).uniqueBits; ++bit) {
+					t_buffer.writeText(t_prefix + m_encodedPartitions.at(i).name + std::to_string(bit));
 				}
 			}
-			oStream << "\n";
+			else {
+				t_buffer.writeText(t_prefix + m_encodedPartitions.at(i).name);
+			}
+		}
+	}
 
-			// Write each Chromo
-			std::size_t id{ 0 };
-			for (auto it{ std::begin(m_chromo) }; it != std::end(m_chromo); ++it)
+	/**
+	*	@brief  Adds this generation's row to the history file (see setHistoryFile()).
+	*	The mean is of valid scores only. Fewer top Chromos are written
+	*	if there are not enough with valid scores.
+	*
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::writeHistoryRow()
+	{
+		m_historyKeys.clear();
+		double scoreTotal{ 0.0 };
+		for (std::size_t i{ 0 }; i < m_chromo.size(); ++i)
+		{
+			const double score{ m_chromo[i]->getScore() };
+			if (score > 0.0)
 			{
-				(*it)->writeToFileAsCSV(id++, oStream);
+				m_historyKeys.push_back(ScoreKey{ score, i });
+				scoreTotal += score;
 			}
-
-			oStream.close();
-
 		}
-		else std::cout << "\nERROR: Unable to open file " + t_filename + "\n\n";
+		const std::size_t topCount{ std::min(m_historyChromoCount, m_historyKeys.size()) };
+		std::partial_sort(m_historyKeys.begin(), m_historyKeys.begin() + topCount, m_historyKeys.end(), isBetterScoreKey);
+
+		bif::CSVBuffer& buffer{ m_historyWriter->getBuffer() };
+		buffer.write(m_currentGeneration);
+		buffer.write(m_historyKeys.empty() ? 0.0 : m_historyKeys.front().score);
+		buffer.write(m_historyKeys.empty() ? 0.0 : scoreTotal / static_cast<double>(m_historyKeys.size()));
+		for (std::size_t i{ 0 }; i < topCount; ++i)
+		{
+			C* chromo{ m_chromo[m_historyKeys[i].index] };
+			decodeChromo(chromo);
+			chromo->writeToCSVBuffer(i, buffer);
+		}
+		m_historyWriter->endLine();
 	}
 
 	/**
@@ -464,23 +1127,24 @@ namespace ga
 			std::getline(iStream, line);
 			// Read GA settings
 			std::getline(iStream, line);
-			std::vector<std::string> gaSettings = bif::Import::parseString(line, ",", bif::Import::CleanTokenBy::none);
-			stringToNumber(gaSettings.at(0), m_currentGeneration);
-			stringToNumber(gaSettings.at(1), newGenerationSize);
-			stringToNumber(gaSettings.at(2), m_mutationCountMax);
-			stringToNumber(gaSettings.at(3), m_mutationBitWidth);
-			stringToNumber(gaSettings.at(4), m_mutationChanceIn100);
-			stringToNumber(gaSettings.at(5), m_numEvolveCopy);
-			stringToNumber(gaSettings.at(6), m_numEvolveShuffle);
-			stringToNumber(gaSettings.at(7), m_numEvolveCrossover);
-			stringToNumber(gaSettings.at(8), m_numEvolveMutate);
-			stringToNumber(gaSettings.at(9), tempInt);
+			bif::CSVCursor gaSettings(line);
+			gaSettings.read(m_currentGeneration);
+			gaSettings.read(newGenerationSize);
+			gaSettings.read(m_mutationCountMax);
+			gaSettings.read(m_mutationBitWidth);
+			double mutationChanceIn100;
+			gaSettings.read(mutationChanceIn100);
+			m_mutationChance = mutationChanceIn100 / 100.0;
+			gaSettings.read(m_numEvolveCopy);
+			gaSettings.read(m_numEvolveShuffle);
+			gaSettings.read(m_numEvolveCrossover);
+			gaSettings.read(m_numEvolveMutate);
+			gaSettings.read(tempInt);
 			m_mutationSelection = static_cast<MutationSelection>(tempInt);
 
 			// Apply GA setting - Generation Size
 			if (m_generationSize != newGenerationSize) {
-				m_generationSize = newGenerationSize;
-				m_chromo.resize(m_generationSize, new C(0, m_randomGenerator));
+				resizeGeneration(newGenerationSize);
 			}
 
 			// Read blank line
@@ -496,7 +1160,7 @@ namespace ga
 				(*it)->readFromFileAsCSV(iStream);
 				(*it)->applyLimits();
 				// Update encoded strings
-				(*it)->encode();
+				encodeChromo(*it);
 			}
 
 			iStream.close();
@@ -504,6 +1168,54 @@ namespace ga
 		else std::cout << "\nERROR: Unable to open file " + t_filename + "\n\n";
 	}
 
+	/**
+	*	@brief  Copies the encoded strings of the best Chromos, best first.
+	*	This reads the Elite Chromos found during the last selection phase,
+	*	so it should be called after advanceGeneration(). Elite Chromos are
+	*	not always kept in score order, so only their keys are sorted here.
+	*
+	*	@param  t_encodings is cleared and filled with the encoded strings
+	*	@param  t_count specifies the maximum number of Chromos to copy
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::getTopEncodings(std::vector<std::string>& t_encodings, const std::size_t t_count) const
+	{
+		t_encodings.clear();
+		std::vector<ScoreKey> keys(m_numEvolveElite);
+		for (std::size_t i{ 0 }; i < keys.size(); ++i) {
+			keys.at(i).score = m_chromo.at(i)->getScore();
+			keys.at(i).index = i;
+		}
+		const std::size_t count{ std::min(t_count, keys.size()) };
+		std::partial_sort(keys.begin(), keys.begin() + count, keys.end(), isBetterScoreKey);
+		for (std::size_t i{ 0 }; i < count; ++i) {
+			t_encodings.push_back(m_chromo.at(keys.at(i).index)->getEncoding());
+		}
+	}
+
+	/**
+	*	@brief  Replaces the last Volatile Chromos with encoded strings from another GA.
+	*	Migrants are decoded and limited, then scored along with the
+	*	rest of the generation during the next selection phase.
+	*	Elite Chromos are never replaced.
+	*
+	*	@param  t_migrants specifies the encoded strings to import
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::importMigrants(const std::vector<std::string>& t_migrants)
+	{
+		const std::size_t volatileCount{ m_generationSize - std::min(m_numEvolveElite, m_generationSize) };
+		const std::size_t count{ std::min(t_migrants.size(), volatileCount) };
+		for (std::size_t i{ 0 }; i < count; ++i)
+		{
+			C* migrant{ m_chromo.at(m_generationSize - 1 - i) };
+			migrant->setEncoding(t_migrants.at(i));
+			decodeChromo(migrant);
+		}
+	}
+
 	/**
 	*	@brief  (Upcoming Feature!)
 	*
@@ -519,7 +1231,7 @@ namespace ga
 	/**
 	*	@brief  Calls selection methods and ensures that there are enough valid Chromos for the rest of the generation.
 	*	Runs fitness function on the Chromos to get their fitness scores
-	*	and sorts them by those scores in order to mark the best scoring Chromos
+	*	and moves the best scoring Chromos to the front in order to mark them
 	*	as Elite.
 	*	
 	*	Elite Chromos are not modified during the crossover and mutation phases,
@@ -534,11 +1246,14 @@ namespace ga
 	template <typename C>
 	bool GeneticAlgorithm<C>::runSelectionPhase(const bool showDebugMessages)
 	{
+		GA_METRIC_TIMER(m_metrics, selection);
 		getFitnessScores();
-		sortChromoByScore();
 
-		// Calculate indices for crossover and mutation processes
+		// The number of Elite Chromos decides how many are selected
 		determineIdealEliteChromos();
+		selectTopChromos();
+
+		// Calculate indices for crossover and mutation processes
 		determineEliteChromos();
 		determineEvolutionRanges();
 
@@ -549,32 +1264,54 @@ namespace ga
 			return false;
 		}
 
+		// Prepare parent selection for the crossover phase
+		determineParents();
+
 		// Results are valid
 		return true;
 	}
 
 	/**
 	*	@brief  Encodes Chromo data and calls all crossover methods.
+	*	Only Elite Chromos and parents are encoded, since every other Volatile
+	*	Chromo is overwritten. Chromos that were already encoded in an earlier
+	*	generation are skipped.
+	*
 	*	Crossover methods are run on individual Chromos marked as Volatile
-	*	due to having either invalid or low fitness scores
+	*	due to having either invalid or low fitness scores.
+	*	If double buffering is enabled, the results are written to the
+	*	offspring instead, which then become the current generation.
 	*	Methods used:
-	*		COPIES - Choose a random Elite Chromo and copy data from it.
-	*		SHUFFLES - Choose 2 random Elite Chromos and randomly copy data from them.
-	*		CROSSOVERS - Choose 2 random Elite Chromos and uUse n-Split crossover
+	*		COPIES - Choose a parent and copy data from it.
+	*		SHUFFLES - Choose 2 parents and randomly copy data from them.
+	*		CROSSOVERS - Choose 2 parents and uUse n-Split crossover
 	*	method to copy data from them.
+	*	Parents are chosen by m_parentSelection (see pickParent()).
 	*
 	*	@return void
 	*/
 	template <typename C>
 	void GeneticAlgorithm<C>::runCrossoverPhase(const bool showDebugMessages)
 	{
-		// Convert from variables to encoded strings
-		encodeChromos();
+		GA_METRIC_TIMER(m_metrics, crossover);
+
+		// Convert parents from variables to encoded strings
+		{
+			GA_METRIC_TIMER(m_metrics, encode);
+			for (std::size_t i{ 0 }; i < std::max(m_numEvolveElite, m_numParents); ++i)
+			{
+				encodeChromo(m_chromo.at(i));
+			}
+		}
 
 		// Crossover phase
 		doCopies();
 		doShuffles();
 		doCrossovers();
+
+		if (m_isDoubleBuffered) {
+			swapGenerations();
+		}
 	}
 
 	/**
@@ -583,14 +1320,20 @@ namespace ga
 	*	phase.
 	*
 	*	Calls doMutations() to mutate the encoded data, then decodes
-	*	all Chromos. If applicable, runs custom mutations which are performed
-	*	by the inherited Chromo class.
+	*	the Chromos that changed. If applicable, runs custom mutations which
+	*	are performed by the inherited Chromo class.
+	*
+	*	Custom mutations are not encoded here. Chromos are encoded when
+	*	they are next needed, which is only if they become Elite or are
+	*	looked up in the fitness cache.
 	*
 	*	@return void
 	*/
 	template <typename C>
 	void GeneticAlgorithm<C>::runMutationPhase(const bool showDebugMessages)
 	{
+		GA_METRIC_TIMER(m_metrics, mutation);
+
 		// Mutation phase (part 1)
 		// Mutate the encoded data
 		doMutations();
@@ -599,7 +1342,10 @@ namespace ga
 		}
 		
 		// Convert from encoded strings back to variables
-		decodeChromos();
+		{
+			GA_METRIC_TIMER(m_metrics, decode);
+			decodeChromos();
+		}
 		if (showDebugMessages) {
 			std::cout << "decodeChromos() complete...\n";
 		}
@@ -608,9 +1354,6 @@ namespace ga
 			// Mutation phase (part 2)
 			// Mutate the variables directly
 			doCustomMutations();
-
-			// Update encoded string with the new mutations
-			encodeChromos();
 		}
 	}
 
@@ -664,9 +1407,33 @@ namespace ga
 	}
 
 	/**
-	*	@brief  Sets m_mutationChanceIn100, the chance of any bit within a mutation block being toggled
+	*	@brief  Sets m_mutationChance, the chance of any bit within a mutation block being toggled
+	*	Small chances are cheap, even over very wide mutation blocks,
+	*	as only the bits that are toggled cost any time.
 	*	If you want to disable mutations, use setNumberToMutate(0)
 	*
+	*	@param  t_mutationChance is the new mutation chance. Must be in the range (0, 1].
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setMutationChance(const double t_mutationChance)
+	{
+		if (t_mutationChance > 0.0 && t_mutationChance <= 1.0) {
+			m_mutationChance = t_mutationChance;
+		}
+		else if (t_mutationChance > 1.0) {
+			m_mutationChance = 1.0;
+			std::cout << "\nERROR: Mutation chance must be greater than 0 and no more than 1. Setting to 1.\n\n";
+		}
+		else {
+			m_mutationChance = 0.01;
+			std::cout << "\nERROR: Mutation chance must be greater than 0 and no more than 1. Setting to 0.01.\n\n";
+		}
+	}
+
+	/**
+	*	@brief  Sets the mutation chance as a whole number out of 100. See setMutationChance().
+	*
 	*	@param  t_mutationChanceIn100 is the new mutation chance, out of 100. Must be in the range [1, 100].
 	*	@return void
 	*/
@@ -674,14 +1441,14 @@ namespace ga
 	void GeneticAlgorithm<C>::setMutationChanceIn100(const short int t_mutationChanceIn100)
 	{
 		if (t_mutationChanceIn100 > 0 && t_mutationChanceIn100 <= 100) {
-			m_mutationChanceIn100 = t_mutationChanceIn100;
+			m_mutationChance = t_mutationChanceIn100 / 100.0;
 		}
 		else {
 			if (t_mutationChanceIn100 == 0) {
-				m_mutationChanceIn100 = 1;
+				m_mutationChance = 0.01;
 				std::cout << "\nERROR: Mutation chance in 100 must be between 1 and 100, inclusive. Setting to 1.\n\n";
 			} else {
-				m_mutationChanceIn100 = 100;
+				m_mutationChance = 1.0;
 				std::cout << "\nERROR: Mutation chance in 100 must be between 1 and 100, inclusive. Setting to 100.\n\n";
 			}
 			
@@ -762,6 +1529,338 @@ namespace ga
 		}
 	}
 
+	/**
+	*	@brief  Sets m_shuffleMode, which controls whether shuffles choose whole bytes or single bits from each parent.
+	*	ShuffleMode::bit mixes parents more finely, which helps
+	*	when many values are packed into each byte, such as bool vectors.
+	*
+	*	@param  t_shuffleMode must be ShuffleMode::byte or ShuffleMode::bit.
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setShuffleMode(const ShuffleMode t_shuffleMode)
+	{
+		if (t_shuffleMode == ShuffleMode::byte || t_shuffleMode == ShuffleMode::bit) {
+			m_shuffleMode = t_shuffleMode;
+		}
+		else {
+			m_shuffleMode = ShuffleMode::byte;
+			std::cout << "\nERROR: Shuffle mode must be byte or bit. Setting to byte.\n\n";
+		}
+	}
+
+	/**
+	*	@brief  Sets m_parentSelection, which controls how parents are chosen in the crossover phase.
+	*	See pickParent() for a description of each scheme.
+	*	Without double buffering, parents are always Elite Chromos, since
+	*	Volatile Chromos are overwritten during the crossover phase.
+	*
+	*	@param  t_parentSelection must be a ParentSelection value. ParentSelection::uniformElite is the default.
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setParentSelection(const ParentSelection t_parentSelection)
+	{
+		switch (t_parentSelection)
+		{
+		case ParentSelection::uniformElite:
+		case ParentSelection::tournament:
+		case ParentSelection::roulette:
+		case ParentSelection::rank:
+		case ParentSelection::truncation:
+			m_parentSelection = t_parentSelection;
+			break;
+		default:
+			m_parentSelection = ParentSelection::uniformElite;
+			std::cout << "\nERROR: Parent selection must be uniformElite, tournament, roulette, rank or truncation. Setting to uniformElite.\n\n";
+			break;
+		}
+	}
+
+	/**
+	*	@brief  Sets m_tournamentSize, the number of Chromos drawn for each tournament.
+	*	Larger tournaments favor the best Chromos more strongly.
+	*	A size of 1 chooses parents uniformly.
+	*
+	*	@param  t_tournamentSize must be at least 1.
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setTournamentSize(const std::size_t t_tournamentSize)
+	{
+		if (t_tournamentSize >= 1) {
+			m_tournamentSize = t_tournamentSize;
+		}
+		else {
+			m_tournamentSize = 2;
+			std::cout << "\nERROR: Tournament size must be at least 1. Setting to 2.\n\n";
+		}
+	}
+
+	/**
+	*	@brief  Sets m_truncationCount, the number of top Chromos used as parents by truncation selection.
+	*	Without double buffering, this is limited to the number of Elite Chromos.
+	*
+	*	@param  t_truncationCount must be at least 2, or 0 to use every Elite Chromo.
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setTruncationCount(const std::size_t t_truncationCount)
+	{
+		if (t_truncationCount != 1) {
+			m_truncationCount = t_truncationCount;
+		}
+		else {
+			m_truncationCount = 2;
+			std::cout << "\nERROR: Truncation count must be at least 2. Setting to 2.\n\n";
+		}
+	}
+
+	/**
+	*	@brief  Sets m_threadCount, the number of threads used by parallel phases.
+	*	If a thread pool already exists with a different thread count, it is
+	*	replaced. Otherwise the pool is created the first time a parallel
+	*	phase is enabled.
+	*
+	*	@param  t_threadCount is the new thread count. 0 uses the hardware thread count.
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setThreadCount(const std::size_t t_threadCount)
+	{
+		m_threadCount = t_threadCount;
+
+		const std::size_t threadCount{ m_threadCount > 0 ? m_threadCount : ThreadPool::getDefaultThreadCount() };
+		if (m_threadPool && m_threadPool->getThreadCount() != threadCount) {
+			m_threadPool.reset(new ThreadPool(threadCount));
+		}
+	}
+
+	/**
+	*	@brief  Sets m_parallelChunkSize, the number of Chromos given to a thread at a time.
+	*	Larger chunks have less overhead, while smaller chunks balance
+	*	uneven fitness functions better.
+	*
+	*	@param  t_parallelChunkSize must be at least 1.
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setParallelChunkSize(const std::size_t t_parallelChunkSize)
+	{
+		if (t_parallelChunkSize >= 1) {
+			m_parallelChunkSize = t_parallelChunkSize;
+		}
+		else {
+			m_parallelChunkSize = 1;
+			std::cout << "\nERROR: Parallel chunk size must be at least 1. Setting to 1.\n\n";
+		}
+	}
+
+	/**
+	*	@brief  Enables or disables running fitness functions on the thread pool.
+	*	runFitnessFunctionBatch() is called from several threads at once,
+	*	each with its own chunk of Chromos, so it must only modify the
+	*	Chromos it is given. Scores are the same as the serial path.
+	*
+	*	@param  t_isParallelFitness enables parallel fitness evaluation
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setParallelFitness(const bool t_isParallelFitness)
+	{
+		m_isParallelFitness = t_isParallelFitness;
+
+		if (m_isParallelFitness && !m_threadPool) {
+			m_threadPool.reset(new ThreadPool(m_threadCount));
+		}
+	}
+
+	/**
+	*	@brief  Enables or disables finding the top scoring Chromos on the thread pool.
+	*	Each thread finds the best Chromos in its own share of the generation,
+	*	then the best of those are found. This helps when the generation is
+	*	large and the number of Elite Chromos is small. Otherwise the
+	*	selection runs on one thread. The same Chromos are selected either way,
+	*	though the Elite Chromos may end up in a different order.
+	*
+	*	@param  t_isParallelSelection specifies whether to use the thread pool
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setParallelSelection(const bool t_isParallelSelection)
+	{
+		m_isParallelSelection = t_isParallelSelection;
+
+		if (m_isParallelSelection && !m_threadPool) {
+			m_threadPool.reset(new ThreadPool(m_threadCount));
+		}
+	}
+
+	/**
+	*	@brief  Returns the GA's thread pool, so that other phases can share the same threads.
+	*
+	*	@return Pointer to the thread pool, or nullptr if no parallel setting has been enabled
+	*/
+	template <typename C>
+	ThreadPool* GeneticAlgorithm<C>::getThreadPool()
+	{
+		return m_threadPool.get();
+	}
+
+	/**
+	*	@brief  Enables the fitness cache, which remembers the scores of recently seen encoded strings.
+	*	When a changed Chromo has the same encoded string as one scored
+	*	before, its score is reused rather than running the fitness function.
+	*	The least recently used scores are forgotten when the cache is full.
+	*
+	*	This requires the fitness function to depend only on the encoded data.
+	*	Changing the size clears the cache.
+	*
+	*	@param  t_fitnessCacheSize is the maximum number of scores to keep. Use 0 to disable the cache.
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setFitnessCacheSize(const std::size_t t_fitnessCacheSize)
+	{
+		if (t_fitnessCacheSize > 0) {
+			m_fitnessCache.reset(new FitnessCache(t_fitnessCacheSize));
+		}
+		else {
+			m_fitnessCache.reset();
+		}
+	}
+
+	/**
+	*	@brief  Returns the number of scores found in the fitness cache.
+	*
+	*	@return Cache hits, or 0 if the cache is disabled
+	*/
+	template <typename C>
+	unsigned long long int GeneticAlgorithm<C>::getFitnessCacheHits() const
+	{
+		return m_fitnessCache ? m_fitnessCache->getHits() : 0;
+	}
+
+	/**
+	*	@brief  Returns the number of scores not found in the fitness cache.
+	*
+	*	@return Cache misses, or 0 if the cache is disabled
+	*/
+	template <typename C>
+	unsigned long long int GeneticAlgorithm<C>::getFitnessCacheMisses() const
+	{
+		return m_fitnessCache ? m_fitnessCache->getMisses() : 0;
+	}
+
+	/**
+	*	@brief  Returns the number of times a fitness function has been run.
+	*	Unchanged Chromos, cache hits, and scores updated from changed partitions are not counted.
+	*
+	*	@return m_fitnessEvaluationCount
+	*/
+	template <typename C>
+	unsigned long long int GeneticAlgorithm<C>::getFitnessEvaluationCount() const
+	{
+		return m_fitnessEvaluationCount;
+	}
+
+	/**
+	*	@brief  Returns the number of scores updated from only their changed partitions, rather than by the full fitness function.
+	*	Only Chromos declaring hasFitnessUpdate() as true are updated.
+	*
+	*	@return m_fitnessUpdateCount
+	*/
+	template <typename C>
+	unsigned long long int GeneticAlgorithm<C>::getFitnessUpdateCount() const
+	{
+		return m_fitnessUpdateCount;
+	}
+
+	/**
+	*	@brief  Enables or disables contiguous storage.
+	*	When enabled, the encoded data of every Chromo is moved into one
+	*	aligned block with a fixed stride, and scores are kept in a dense
+	*	array. Crossovers, mutations, sorting, and file I/O then work on
+	*	that block directly. The stride is taken from getEncodedPartitions(),
+	*	so every encoded byte must belong to a partition. The Chromo objects
+	*	themselves are still allocated separately.
+	*
+	*	@param  t_isContiguousStorage enables contiguous storage
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setContiguousStorage(const bool t_isContiguousStorage)
+	{
+		if (t_isContiguousStorage) {
+			bindPopulation();
+		}
+		else {
+			unbindPopulation();
+		}
+	}
+
+	/**
+	*	@brief  Returns true if contiguous storage is enabled.
+	*
+	*	@return m_isContiguousStorage
+	*/
+	template <typename C>
+	bool GeneticAlgorithm<C>::isContiguousStorage() const
+	{
+		return m_isContiguousStorage;
+	}
+
+	/**
+	*	@brief  Enables or disables double buffering.
+	*	When enabled, a second set of Chromos is kept for offspring.
+	*	The crossover phase writes every Volatile Chromo into the
+	*	offspring, rather than over the current generation, and the
+	*	two sets are then swapped. Elite Chromos are moved by pointer,
+	*	so they are never copied. Parents are never overwritten while
+	*	the crossover phase is running.
+	*
+	*	@param  t_isDoubleBuffered enables double buffering
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::setDoubleBuffering(const bool t_isDoubleBuffered)
+	{
+		if (t_isDoubleBuffered == m_isDoubleBuffered) {
+			return;
+		}
+
+		// Offspring also have slots in the PopulationBuffer, so it is rebuilt
+		const bool isContiguousStorage{ m_isContiguousStorage };
+		unbindPopulation();
+
+		if (t_isDoubleBuffered) {
+			for (std::size_t i{ 0 }; i < m_chromo.size(); ++i) {
+				m_offspring.push_back(createChromo(0));
+			}
+		}
+		else {
+			for (auto p : m_offspring)
+				delete p;
+			m_offspring.clear();
+		}
+		m_isDoubleBuffered = t_isDoubleBuffered;
+
+		if (isContiguousStorage) {
+			bindPopulation();
+		}
+	}
+
+	/**
+	*	@brief  Returns true if double buffering is enabled.
+	*
+	*	@return m_isDoubleBuffered
+	*/
+	template <typename C>
+	bool GeneticAlgorithm<C>::isDoubleBuffered() const
+	{
+		return m_isDoubleBuffered;
+	}
+
 	/**
 	*	@brief  Utility function that ensures GA settings for crossovers and mutations are within the bounds of the generation size.
 	*	Tests for minimum generation size, having at least 2 Elite Chromos during
@@ -815,56 +1914,95 @@ namespace ga
 	}
 
 	/**
-	*	@brief  A crossover method that replaces data in Volatile Chromos with direct copies of encoded data in Elite Chromos.
+	*	@brief  Returns the times and counters of the last call to advanceGeneration().
+	*	Everything is 0 unless GA_ENABLE_METRICS is defined (see GenerationMetrics.h).
+	*
+	*	@return Metrics of the last generation
+	*/
+	template <typename C>
+	const GenerationMetrics& GeneticAlgorithm<C>::getMetrics() const
+	{
+		return m_metrics;
+	}
+
+	/**
+	*	@brief  Returns the times and counters of every generation since the GA was created or resetMetrics() was called.
+	*
+	*	@return Metrics of every generation, added together
+	*/
+	template <typename C>
+	const GenerationMetrics& GeneticAlgorithm<C>::getTotalMetrics() const
+	{
+		return m_totalMetrics;
+	}
+
+	/**
+	*	@brief  Sets the metrics of the last generation, and of every generation, to 0.
+	*
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::resetMetrics()
+	{
+		m_metrics.reset();
+		m_totalMetrics.reset();
+	}
+
+	/**
+	*	@brief  A crossover method that replaces data in Volatile Chromos with direct copies of encoded data in parent Chromos.
 	*
 	*	@return void
 	*/
 	template <typename C>
 	void GeneticAlgorithm<C>::doCopies()
 	{
+		GA_METRIC_TIMER(m_metrics, copies);
+
 		// Calculate last ID, based on the user-specified number to copy
 		// Chromos which would normally be Elite yet have invalid scores are also copied
 		const std::size_t lastIdToCopy{ m_firstIdEvolveCopy + m_numEvolveCopy + m_numEvolveCopyExtra };
 
 		for (std::size_t i = m_firstIdEvolveCopy; i < lastIdToCopy; ++i)
 		{
-			// One parent is randomly chosen from best chromos
-			std::size_t parentId{ pickRandomEliteChromo() };
+			// One parent is chosen from best chromos
+			std::size_t parentId{ pickParent() };
 			C* parent = m_chromo.at(parentId);
 
 			// Replace unworthy chromo
-			m_chromo.at(i)->copyParent(*parent);
+			getOffspring(i)->copyParent(*parent);
 		}
 	}
 
 	/**
-	*	@brief  A crossover method that replaces data in Volatile Chromos with shuffled data from two random Elite Chromos.
-	*	Each byte in the encoded data is chosen randomly from the
-	*	corresponding bytes of the parent Chromos.
+	*	@brief  A crossover method that replaces data in Volatile Chromos with shuffled data from two parent Chromos.
+	*	Each byte (or bit, depending on m_shuffleMode) in the encoded data
+	*	is chosen randomly from the corresponding bytes of the parent Chromos.
 	*
 	*	@return void
 	*/
 	template <typename C>
 	void GeneticAlgorithm<C>::doShuffles()
 	{
+		GA_METRIC_TIMER(m_metrics, shuffles);
+
 		if (m_numEvolveShuffle > 0)
 		{
 			for (std::size_t i = m_firstIdEvolveShuffle; i < m_firstIdEvolveShuffle + m_numEvolveShuffle; ++i)
 			{
-				// Two parents are randomly chosen from best chromos
+				// Two parents are chosen from best chromos
 				std::size_t parentId1{ 0 };
 				std::size_t parentId2{ 0 };
-				pickTwoRandomEliteChromos(parentId1, parentId2);
+				pickTwoParents(parentId1, parentId2);
 
 				// Replace unworthy chromo
-				m_chromo.at(i)->shuffleFromParents(*m_chromo.at(parentId1), *m_chromo.at(parentId2));
+				getOffspring(i)->shuffleFromParents(*m_chromo.at(parentId1), *m_chromo.at(parentId2), m_shuffleMode);
 
 			}
 		}
 	}
 
 	/**
-	*	@brief  A crossover method that replaces data in Volatile Chromos with data crossed over from two random Elite Chromos.
+	*	@brief  A crossover method that replaces data in Volatile Chromos with data crossed over from two parent Chromos.
 	*	The default crossover used is n-Split, found in Chromo.h.
 	*
 	*	@return void
@@ -872,15 +2010,17 @@ namespace ga
 	template <typename C>
 	void GeneticAlgorithm<C>::doCrossovers()
 	{
+		GA_METRIC_TIMER(m_metrics, crossovers);
+
 		for (std::size_t i{ m_firstIdEvolveCrossover }; i < m_firstIdEvolveCrossover + m_numEvolveCrossover; ++i)
 		{
-			// Two parents are randomly chosen from best chromos
+			// Two parents are chosen from best chromos
 			std::size_t parentId1{ 0 };
 			std::size_t parentId2{ 0 };
-			pickTwoRandomEliteChromos(parentId1, parentId2);
+			pickTwoParents(parentId1, parentId2);
 
 			// Replace unworthy chromo
-			m_chromo.at(i)->crossoverFromParents(*m_chromo.at(parentId1), *m_chromo.at(parentId2), m_numCrossoverSplits);
+			getOffspring(i)->crossoverFromParents(*m_chromo.at(parentId1), *m_chromo.at(parentId2), m_numCrossoverSplits);
 		}
 	}
 
@@ -941,34 +2081,141 @@ namespace ga
 		}
 	}
 
+	/**
+	*	@brief  Chooses a parent for the crossover phase, using m_parentSelection.
+	*		UNIFORM ELITE - Any Elite Chromo, each equally likely.
+	*		TOURNAMENT - The best of m_tournamentSize random Chromos.
+	*		ROULETTE - The chance of each Chromo is proportional to its score.
+	*		RANK - The chance of each Chromo is proportional to its place in the
+	*	score order, from n for the best down to 1 for the worst.
+	*		TRUNCATION - Any of the top m_truncationCount Chromos, each equally likely.
+	*	Each choice takes constant time. Roulette and rank selection
+	*	draw from the alias table built by determineParents().
+	*
+	*	@return Index of the parent
+	*/
+	template <typename C>
+	std::size_t GeneticAlgorithm<C>::pickParent()
+	{
+		switch (m_parentSelection)
+		{
+		case ParentSelection::tournament:
+			return pickTournamentWinner();
+		case ParentSelection::roulette:
+		case ParentSelection::rank:
+			return m_selectionTable.sample(m_randomGenerator);
+		case ParentSelection::truncation:
+			return m_numParents > 1 ? m_randomGenerator.nextIndex(m_numParents) : 0;
+		default:
+			return pickRandomEliteChromo();
+		}
+	}
+
+	/**
+	*	@brief  Chooses two parents for the crossover phase, using m_parentSelection.
+	*	Tournament, roulette and rank selection draw the second parent again
+	*	while it matches the first. If one Chromo holds nearly all of the
+	*	weight, the number of draws is limited and both parents may be the same.
+	*
+	*	@param  t_parentId1 will be set to the index of the first parent
+	*	@param  t_parentId2 will be set to the index of the second parent
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::pickTwoParents(std::size_t& t_parentId1, std::size_t& t_parentId2)
+	{
+		if (m_parentSelection == ParentSelection::uniformElite) {
+			pickTwoRandomEliteChromos(t_parentId1, t_parentId2);
+		}
+		else if (m_parentSelection == ParentSelection::truncation) {
+			// Same method as pickTwoRandomEliteChromos(),
+			// over the top m_numParents Chromos
+			if (m_numParents <= 1) {
+				// Not enough parents to choose
+				t_parentId1 = 0;
+				t_parentId2 = 0;
+				return;
+			}
+			t_parentId1 = m_randomGenerator.nextIndex(m_numParents);
+			t_parentId2 = m_randomGenerator.nextIndex(m_numParents - 1);
+			if (t_parentId2 >= t_parentId1) {
+				++t_parentId2;
+			}
+		}
+		else {
+			const std::size_t maxRedraws{ 16 };
+			t_parentId1 = pickParent();
+			t_parentId2 = pickParent();
+			for (std::size_t i{ 0 }; t_parentId2 == t_parentId1 && i < maxRedraws; ++i) {
+				t_parentId2 = pickParent();
+			}
+		}
+	}
+
+	/**
+	*	@brief  Draws m_tournamentSize random parents and returns the best one.
+	*	Scores are read from the dense copy made by determineParents().
+	*
+	*	@return Index of the winning parent
+	*/
+	template <typename C>
+	std::size_t GeneticAlgorithm<C>::pickTournamentWinner()
+	{
+		if (m_numParents <= 1) {
+			// Not enough parents to choose
+			return 0;
+		}
+		std::size_t winner{ m_randomGenerator.nextIndex(m_numParents) };
+		for (std::size_t i{ 1 }; i < m_tournamentSize; ++i)
+		{
+			const std::size_t challenger{ m_randomGenerator.nextIndex(m_numParents) };
+			if (m_selectionWeights[challenger] > m_selectionWeights[winner]) {
+				winner = challenger;
+			}
+		}
+
+		// With double buffering, every Chromo drawn may have been invalid
+		if (m_selectionWeights[winner] <= 0) {
+			return pickRandomEliteChromo();
+		}
+		return winner;
+	}
+
 	/**
 	*	@brief  Chooses random Chromos to mutate and calls their mutate() method.
 	*	Chromos will not be mutated twice.
+	*	The list of chosen Chromos is reused each generation.
 	*
 	*	@return void
 	*/
 	template <typename C>
 	void GeneticAlgorithm<C>::doMutations()
 	{
-		std::vector<std::size_t> mutationList;
+		GA_METRIC_TIMER(m_metrics, mutations);
+
+		m_mutationList.clear();
 		if (m_numEvolveMutate < m_generationSize - m_numEvolveElite) {
 			// Pick random Volatile Chromos to mutate,
 			// ensuring that none are picked twice
-			getUniqueRandomNumbers(mutationList, m_numEvolveMutate, m_numEvolveElite, m_generationSize, m_randomGenerator);
+			getUniqueRandomNumbers(m_mutationList, m_numEvolveMutate, m_numEvolveElite, m_generationSize, m_randomGenerator);
 			for (std::size_t i{ 0 }; i < m_numEvolveMutate; ++i)
 			{
-				m_chromo.at(mutationList.at(i))->mutate(m_encodedPartitions, m_mutationLimits, m_mutationSelection,
-					m_mutationCountMax, m_mutationBitWidth, m_mutationChanceIn100);
+				const std::size_t mutatedBytes{ m_chromo.at(m_mutationList.at(i))->mutate(m_encodedPartitions, m_mutationLimits, m_mutationSelection,
+					m_mutationCountMax, m_mutationBitWidth, m_mutationChance) };
+				GA_METRIC_ADD(m_metrics, mutatedBytes, mutatedBytes);
 			}
+			GA_METRIC_ADD(m_metrics, mutatedChromos, m_numEvolveMutate);
 		}
 		else {
 			// If there are not enough Volatile Chromos to choose from,
 			// instead mutate all Volatile
 			for (std::size_t i{ m_firstIdEvolveMutate }; i< m_generationSize; ++i)
 			{
-				m_chromo.at(i)->mutate(m_encodedPartitions, m_mutationLimits, m_mutationSelection,
-					m_mutationCountMax, m_mutationBitWidth, m_mutationChanceIn100);
+				const std::size_t mutatedBytes{ m_chromo.at(i)->mutate(m_encodedPartitions, m_mutationLimits, m_mutationSelection,
+					m_mutationCountMax, m_mutationBitWidth, m_mutationChance) };
+				GA_METRIC_ADD(m_metrics, mutatedBytes, mutatedBytes);
 			}
+			GA_METRIC_ADD(m_metrics, mutatedChromos, m_generationSize - m_firstIdEvolveMutate);
 		}
 	}
 
@@ -985,41 +2232,189 @@ namespace ga
 	template <typename C>
 	void GeneticAlgorithm<C>::doCustomMutations()
 	{
+		GA_METRIC_TIMER(m_metrics, customMutations);
+
 		// Call mutateCustom() for all Volatile chromos
 		// Mutation chance is handled by mutateCustom()
 		for (std::size_t i{ m_firstIdEvolveMutate }; i< m_generationSize; ++i)
 		{
 			m_chromo.at(i)->mutateCustom();
+			m_chromo.at(i)->markVariablesChanged();
 		}
 	}
 
 	/**
-	*	@brief  Iterates through all Chromos, using their fitness function to set their scores.
+	*	@brief  Runs the fitness function on every Chromo whose data has changed since it was last scored.
+	*	Chromos that are unchanged (such as Elite Chromos and unmutated copies)
+	*	keep their scores. If the fitness cache is enabled, changed Chromos
+	*	are looked up by encoding hash before being scored, and new scores
+	*	are added to the cache afterwards.
+	*
+	*	If C::hasFitnessUpdate() is true, each changed Chromo whose changes
+	*	are all known first gets a chance to update its previous score
+	*	with C::updateFitness(), on the thread pool if parallel fitness is
+	*	enabled.
+	*
+	*	The remaining Chromos are scored with C::runFitnessFunctionBatch(),
+	*	all in one call. If parallel fitness is enabled, they are split into
+	*	chunks instead, and each chunk is scored in one call on the thread
+	*	pool. The cache is only used from this thread.
 	*
 	*	@return void
 	*/
 	template <typename C>
 	void GeneticAlgorithm<C>::getFitnessScores()
 	{
-		for (auto it{ std::begin(m_chromo) }; it != std::end(m_chromo); ++it)
+		GA_METRIC_TIMER(m_metrics, fitness);
+
+		// Find Chromos that need scoring
+		m_evaluationList.clear();
+		m_evaluationHashes.clear();
+		for (std::size_t i{ 0 }; i < m_chromo.size(); ++i)
+		{
+			C* chromo{ m_chromo.at(i) };
+			if (!chromo->isScoreStale()) {
+				continue;
+			}
+
+			std::uint64_t hash{ 0 };
+			if (m_fitnessCache)
+			{
+				// The hash must match the current variables
+				encodeChromo(chromo);
+				hash = chromo->getEncodingHash();
+				double score{ 0.0 };
+				if (m_fitnessCache->find(hash, score)) {
+					chromo->restoreScore(score);
+					GA_METRIC_ADD(m_metrics, cacheHits, 1);
+					continue;
+				}
+				GA_METRIC_ADD(m_metrics, cacheMisses, 1);
+			}
+
+			m_evaluationList.push_back(chromo);
+			m_evaluationHashes.push_back(hash);
+		}
+
+		// Chromos with known changes first try to update their previous scores
+		// Any left stale are scored in full
+		std::vector<C*>* fullEvaluationList{ &m_evaluationList };
+		if (C::hasFitnessUpdate() && !m_evaluationList.empty())
+		{
+			auto updateChunk = [this](const std::size_t t_first, const std::size_t t_last)
+			{
+				for (std::size_t i{ t_first }; i < t_last; ++i)
+				{
+					C* chromo{ m_evaluationList[i] };
+					if (chromo->canUpdateFitness()) {
+						chromo->updateFitness(chromo->getScore(), chromo->getChangedPartitions());
+					}
+				}
+			};
+			if (m_isParallelFitness && m_threadPool) {
+				m_threadPool->parallelFor(m_evaluationList.size(), m_parallelChunkSize, updateChunk);
+			}
+			else {
+				updateChunk(static_cast<std::size_t>(0), m_evaluationList.size());
+			}
+
+			m_fullEvaluationList.clear();
+			for (C* chromo : m_evaluationList) {
+				if (chromo->isScoreStale()) {
+					m_fullEvaluationList.push_back(chromo);
+				}
+			}
+			m_fitnessUpdateCount += m_evaluationList.size() - m_fullEvaluationList.size();
+			GA_METRIC_ADD(m_metrics, fitnessUpdates, m_evaluationList.size() - m_fullEvaluationList.size());
+			fullEvaluationList = &m_fullEvaluationList;
+		}
+		m_fitnessEvaluationCount += fullEvaluationList->size();
+		GA_METRIC_ADD(m_metrics, evaluations, fullEvaluationList->size());
+
+		if (m_isParallelFitness && m_threadPool)
+		{
+			auto scoreChunk = [fullEvaluationList](const std::size_t t_first, const std::size_t t_last)
+			{
+				C::runFitnessFunctionBatch(fullEvaluationList->data() + t_first, t_last - t_first);
+			};
+			m_threadPool->parallelFor(fullEvaluationList->size(), m_parallelChunkSize, scoreChunk);
+		}
+		else if (!fullEvaluationList->empty())
 		{
-			// This function will set the Chromo score
-			(*it)->runFitnessFunctionLocal();
+			// This function will set the Chromo scores
+			C::runFitnessFunctionBatch(fullEvaluationList->data(), fullEvaluationList->size());
+		}
+
+		// Remember new scores
+		if (m_fitnessCache)
+		{
+			for (std::size_t i{ 0 }; i < m_evaluationList.size(); ++i)
+			{
+				C* chromo{ m_evaluationList.at(i) };
+				if (!chromo->isScoreStale()) {
+					m_fitnessCache->insert(m_evaluationHashes.at(i), chromo->getScore());
+				}
+			}
 		}
 	}
 
 	/**
-	*	@brief  Runs a partial sort on Chromos to find the top scoring Chromos.
+	*	@brief  Moves the top scoring Chromos to the front, ahead of the rest of the generation.
+	*	Scores are copied into a dense array of (score, index) keys, and
+	*	selectTopScoreKeys() finds the top keys in O(n) time. Only the keys are moved
+	*	during the search, then the Chromo pointers (and slots, with
+	*	contiguous storage) are reordered to match in one pass.
+	*
+	*	The top Chromos are only sorted when parent selection needs them in
+	*	score order. Otherwise valid Chromos are just moved ahead of invalid
+	*	ones, which is all determineEliteChromos() needs.
+	*	The number of Chromos selected comes from determineTopCount().
 	*
 	*	@return void
 	*/
 	template <typename C>
-	void GeneticAlgorithm<C>::sortChromoByScore()
+	void GeneticAlgorithm<C>::selectTopChromos()
 	{
-		// Use only a partial sort because
-		// low scoring Chromos will be overwritten
-		// and their order does not matter.
-		std::partial_sort(m_chromo.begin(), m_chromo.begin() + m_numIdealElite, m_chromo.end(), [](C* x, C* y) { return x->getScore() > y->getScore(); });
+		GA_METRIC_TIMER(m_metrics, sort);
+
+		const std::size_t count{ m_chromo.size() };
+		const std::size_t topCount{ std::min(determineTopCount(), count) };
+		m_scoreKeys.resize(count);
+
+		// With contiguous storage, scores are read from the PopulationBuffer
+		// rather than following a pointer to each Chromo
+		auto fillKeys = [this](const std::size_t t_first, const std::size_t t_last)
+		{
+			for (std::size_t i{ t_first }; i < t_last; ++i) {
+				m_scoreKeys[i].score = m_isContiguousStorage ? m_population.getScore(m_chromoSlots[i]) : m_chromo[i]->getScore();
+				m_scoreKeys[i].index = i;
+			}
+		};
+		ScoreKey* keys{ m_scoreKeys.data() };
+		selectTopScoreKeys(keys, count, topCount, fillKeys, m_isParallelSelection ? m_threadPool.get() : nullptr);
+
+		if (isScoreOrderNeeded()) {
+			std::sort(keys, keys + topCount, isBetterScoreKey);
+		}
+		else {
+			std::partition(keys, keys + topCount, [](const ScoreKey& t_key) { return t_key.score > 0; });
+		}
+
+		// Reorder the Chromos to match the keys
+		m_orderedChromo.resize(count);
+		for (std::size_t i{ 0 }; i < count; ++i) {
+			m_orderedChromo[i] = m_chromo[keys[i].index];
+		}
+		m_chromo.swap(m_orderedChromo);
+
+		if (m_isContiguousStorage)
+		{
+			m_orderedSlots.resize(count);
+			for (std::size_t i{ 0 }; i < count; ++i) {
+				m_orderedSlots[i] = m_chromoSlots[keys[i].index];
+			}
+			m_chromoSlots.swap(m_orderedSlots);
+		}
 	}
 
 	/**
@@ -1049,7 +2444,6 @@ namespace ga
 		m_numEvolveElite = 0;
 		for (std::size_t i{ m_numIdealElite }; i --> 0; )
 		{
-			std::cout << " " << i << " ";
 			if (m_chromo.at(i)->getScore() > 0)
 			{
 				m_numEvolveElite = i + 1;
@@ -1079,7 +2473,98 @@ namespace ga
 	}
 
 	/**
-	*	@brief  Iterates through all Chromos, calling their encode() method.
+	*	@brief  Returns the number of top Chromos that selectTopChromos() must move to the front.
+	*	This is the number of Elite Chromos. With double buffering, rank and
+	*	truncation selection choose parents from beyond the Elite Chromos,
+	*	so those parents are selected as well.
+	*
+	*	@return Number of Chromos to select
+	*/
+	template <typename C>
+	std::size_t GeneticAlgorithm<C>::determineTopCount() const
+	{
+		if (m_isDoubleBuffered)
+		{
+			if (m_parentSelection == ParentSelection::rank) {
+				return m_generationSize;
+			}
+			if (m_parentSelection == ParentSelection::truncation) {
+				return std::max(m_numIdealElite, std::min(m_truncationCount, m_generationSize));
+			}
+		}
+		return m_numIdealElite;
+	}
+
+	/**
+	*	@brief  Returns whether the top Chromos must be sorted by score.
+	*	Rank and truncation selection need parents in score order.
+	*	Other schemes only need to know which Chromos are at the top.
+	*
+	*	@return true if selectTopChromos() must sort the top Chromos
+	*/
+	template <typename C>
+	bool GeneticAlgorithm<C>::isScoreOrderNeeded() const
+	{
+		return m_parentSelection == ParentSelection::rank || m_parentSelection == ParentSelection::truncation;
+	}
+
+	/**
+	*	@brief  Sets m_numParents, and prepares the scores or alias table used to choose between them.
+	*	Without double buffering, Volatile Chromos are overwritten while
+	*	parents are still being chosen, so only Elite Chromos may be parents.
+	*	With double buffering, tournament and roulette selection choose from
+	*	the whole generation, while rank and truncation selection choose from
+	*	the valid Chromos that were sorted.
+	*	The table is built once per generation, in O(n) time.
+	*
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::determineParents()
+	{
+		m_numParents = m_numEvolveElite;
+		if (m_isDoubleBuffered)
+		{
+			if (m_parentSelection == ParentSelection::tournament || m_parentSelection == ParentSelection::roulette) {
+				m_numParents = m_generationSize;
+			}
+			else if (m_parentSelection == ParentSelection::rank || m_parentSelection == ParentSelection::truncation) {
+				// Invalid Chromos are sorted after valid ones
+				m_numParents = determineTopCount();
+				while (m_numParents > m_numEvolveElite && m_chromo[m_numParents - 1]->getScore() <= 0) {
+					--m_numParents;
+				}
+			}
+		}
+		if (m_parentSelection == ParentSelection::truncation && m_truncationCount > 0) {
+			m_numParents = std::min(m_numParents, m_truncationCount);
+		}
+
+		if (m_parentSelection == ParentSelection::tournament || m_parentSelection == ParentSelection::roulette)
+		{
+			// Tournaments compare these scores rather than following a pointer to each Chromo
+			// For roulette selection, invalid Chromos have a weight of 0
+			m_selectionWeights.resize(m_numParents);
+			for (std::size_t i{ 0 }; i < m_numParents; ++i) {
+				m_selectionWeights[i] = m_chromo[i]->getScore();
+			}
+			if (m_parentSelection == ParentSelection::roulette) {
+				m_selectionTable.build(m_selectionWeights.data(), m_numParents);
+			}
+		}
+		else if (m_parentSelection == ParentSelection::rank)
+		{
+			// Parents are in score order, best first
+			m_selectionWeights.resize(m_numParents);
+			for (std::size_t i{ 0 }; i < m_numParents; ++i) {
+				m_selectionWeights[i] = static_cast<double>(m_numParents - i);
+			}
+			m_selectionTable.build(m_selectionWeights.data(), m_numParents);
+		}
+	}
+
+	/**
+	*	@brief  Iterates through all Chromos, calling encode() on those whose variables have changed.
 	*
 	*	@return void
 	*/
@@ -1088,22 +2573,226 @@ namespace ga
 	{
 		for (std::size_t i{ 0 }; i < m_generationSize; ++i)
 		{
-			m_chromo.at(i)->encode();
+			encodeChromo(m_chromo.at(i));
 		}
 	}
 
 	/**
-	*	@brief  Iterates through all Chromos, calling their decode() method.
+	*	@brief  Iterates through all Chromos, calling decode() on those whose encoded strings have changed.
+	*	Only Volatile Chromos are changed during a generation,
+	*	so Elite Chromos are skipped.
 	*
 	*	@return void
 	*/
 	template <typename C>
 	void GeneticAlgorithm<C>::decodeChromos()
 	{
-		for (std::size_t i{ m_numEvolveElite }; i < m_generationSize; ++i)
+		for (std::size_t i{ 0 }; i < m_generationSize; ++i)
+		{
+			decodeChromo(m_chromo.at(i));
+		}
+	}
+
+	/**
+	*	@brief  Creates a Chromo with its own random stream.
+	*	If the Chromo class can update its score from changed partitions,
+	*	change tracking is enabled (see ChangedPartitions.h).
+	*
+	*	@param  t_initialStateId specifies the starting state of the Chromo
+	*	@return the new Chromo, owned by the caller
+	*/
+	template <typename C>
+	C* GeneticAlgorithm<C>::createChromo(const int t_initialStateId)
+	{
+		// Each Chromo gets an independent stream
+		C* chromo{ new C(t_initialStateId, m_randomGenerator.split()) };
+		if (C::hasFitnessUpdate()) {
+			chromo->enableChangeTracking(m_encodedPartitions);
+		}
+		return chromo;
+	}
+
+	/**
+	*	@brief  Changes the number of Chromos, such as when reading a file.
+	*	New Chromos start from initial state 0. If double buffering is
+	*	enabled, the offspring are resized to match.
+	*
+	*	@param  t_generationSize specifies the new number of Chromos
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::resizeGeneration(const std::size_t t_generationSize)
+	{
+		const bool isContiguousStorage{ m_isContiguousStorage };
+		unbindPopulation();
+
+		while (m_chromo.size() > t_generationSize) {
+			delete m_chromo.back();
+			m_chromo.pop_back();
+		}
+		while (m_chromo.size() < t_generationSize) {
+			m_chromo.push_back(createChromo(0));
+		}
+		if (m_isDoubleBuffered)
+		{
+			while (m_offspring.size() > t_generationSize) {
+				delete m_offspring.back();
+				m_offspring.pop_back();
+			}
+			while (m_offspring.size() < t_generationSize) {
+				m_offspring.push_back(createChromo(0));
+			}
+		}
+		m_generationSize = t_generationSize;
+
+		if (isContiguousStorage) {
+			bindPopulation();
+		}
+	}
+
+	/**
+	*	@brief  Allocates the PopulationBuffer and binds every Chromo to a slot.
+	*	Slots are assigned in the current order of m_chromo, followed
+	*	by any offspring. If any Chromo cannot be bound, every Chromo
+	*	keeps its own storage.
+	*
+	*	@return true if every Chromo was bound, false otherwise
+	*/
+	template <typename C>
+	bool GeneticAlgorithm<C>::bindPopulation()
+	{
+		unbindPopulation();
+
+		// The encoded size is the end of the last partition,
+		// unless a Chromo already holds more data than that
+		std::size_t encodedSize{ 0 };
+		for (std::size_t i{ 0 }; i < m_encodedPartitions.size(); ++i) {
+			encodedSize = std::max(encodedSize, m_encodedPartitions.at(i).location + m_encodedPartitions.at(i).bytes);
+		}
+		for (std::size_t i{ 0 }; i < m_chromo.size(); ++i) {
+			encodedSize = std::max(encodedSize, m_chromo.at(i)->getEncodedData().length());
+		}
+		for (std::size_t i{ 0 }; i < m_offspring.size(); ++i) {
+			encodedSize = std::max(encodedSize, m_offspring.at(i)->getEncodedData().length());
+		}
+
+		m_population.allocate(m_chromo.size() + m_offspring.size(), encodedSize);
+		m_slotChromo = m_chromo;
+		m_slotChromo.insert(m_slotChromo.end(), m_offspring.begin(), m_offspring.end());
+		m_chromoSlots.resize(m_chromo.size());
+		for (std::size_t i{ 0 }; i < m_chromo.size(); ++i) {
+			m_chromoSlots.at(i) = i;
+		}
+		m_offspringSlots.resize(m_offspring.size());
+		for (std::size_t i{ 0 }; i < m_offspring.size(); ++i) {
+			m_offspringSlots.at(i) = m_chromo.size() + i;
+		}
+		m_isContiguousStorage = true;
+		for (std::size_t slot{ 0 }; slot < m_slotChromo.size(); ++slot)
+		{
+			if (!m_slotChromo.at(slot)->bindToPopulation(m_population, slot)) {
+				std::cout << "\nERROR: Chromo " << slot << " does not fit its population slot. Contiguous storage is disabled.\n\n";
+				unbindPopulation();
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	*	@brief  Moves every Chromo's data back into its own storage and frees the PopulationBuffer.
+	*
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::unbindPopulation()
+	{
+		if (!m_isContiguousStorage) {
+			return;
+		}
+
+		for (std::size_t slot{ 0 }; slot < m_slotChromo.size(); ++slot) {
+			m_slotChromo.at(slot)->unbindFromPopulation();
+		}
+		m_population.release();
+		m_slotChromo.clear();
+		m_chromoSlots.clear();
+		m_offspringSlots.clear();
+		m_isContiguousStorage = false;
+	}
+
+	/**
+	*	@brief  Returns the Chromo that a crossover method should write to.
+	*
+	*	@param  t_id specifies the index of the Volatile Chromo being replaced
+	*	@return The offspring at t_id if double buffering is enabled, otherwise the Chromo at t_id
+	*/
+	template <typename C>
+	C* GeneticAlgorithm<C>::getOffspring(const std::size_t t_id)
+	{
+		return m_isDoubleBuffered ? m_offspring.at(t_id) : m_chromo.at(t_id);
+	}
+
+	/**
+	*	@brief  Makes the offspring the current generation, at the end of the crossover phase.
+	*	Elite Chromos are swapped into the offspring by pointer, and the
+	*	offspring they replace are kept to be overwritten next generation.
+	*	Only pointers and slot numbers move, so nothing is allocated or copied.
+	*
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::swapGenerations()
+	{
+		for (std::size_t i{ 0 }; i < m_numEvolveElite; ++i)
+		{
+			std::swap(m_chromo.at(i), m_offspring.at(i));
+			if (m_isContiguousStorage) {
+				std::swap(m_chromoSlots.at(i), m_offspringSlots.at(i));
+			}
+		}
+
+		m_chromo.swap(m_offspring);
+		if (m_isContiguousStorage) {
+			m_chromoSlots.swap(m_offspringSlots);
+		}
+	}
+
+	/**
+	*	@brief  Calls a Chromo's encode() method if its variables have changed since the last encode.
+	*
+	*	@param  t_chromo specifies the Chromo to encode
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::encodeChromo(C* t_chromo)
+	{
+		if (t_chromo->isEncodingStale())
+		{
+			t_chromo->encode();
+			t_chromo->markEncoded();
+			GA_METRIC_ADD(m_metrics, encodes, 1);
+		}
+	}
+
+	/**
+	*	@brief  Calls a Chromo's decode() and applyLimits() methods if its encoded string has changed since the last decode.
+	*	Limits may change the variables, so the Chromo is marked
+	*	for encoding. Its score is not affected.
+	*
+	*	@param  t_chromo specifies the Chromo to decode
+	*	@return void
+	*/
+	template <typename C>
+	void GeneticAlgorithm<C>::decodeChromo(C* t_chromo)
+	{
+		if (t_chromo->isDecodingStale())
 		{
-			m_chromo.at(i)->decode();
-			m_chromo.at(i)->applyLimits();
+			t_chromo->decode();
+			t_chromo->markDecoded();
+			GA_METRIC_ADD(m_metrics, decodes, 1);
+			t_chromo->applyLimits();
+			t_chromo->markEncodingStale();
 		}
 	}
 
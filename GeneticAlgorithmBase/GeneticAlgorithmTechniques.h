@@ -7,15 +7,22 @@
 
 #include <iostream>
 #include <vector>
+#include <array>
 #include <string>
 #include <sstream>
+#include <algorithm>
+
+#include "RandomGenerator.h"
+#include "AllocationCounter.h"
+#include "ImportData.h"
 
 namespace ga
 {
 	enum class MutationSelection { pureRandom, randomByte, entirePartition };
 	enum class MutationMode { value, byte, bit };
 	enum class MutationTechnique { randomize, offset };
-	enum class ShuffleMode { value, byte };
+	enum class ShuffleMode { value, byte, bit };
+	enum class ParentSelection { uniformElite, tournament, roulette, rank, truncation };
 	enum class EncodedPartitionType { normal, eachBitUnique };
 
 	struct EncodedPartition
@@ -56,7 +63,7 @@ namespace ga
 	*	@return void
 	*/
 	template <typename C>
-	static void runTestGenerations(int(*t_randomGenerator)(void))
+	static void runTestGenerations(const RandomGenerator t_randomGenerator)
 	{
 		std::cout << "Beginning GA tests...\n";
 		ga::GeneticAlgorithm<C>* gaTest = new ga::GeneticAlgorithm<C>("Test run", 12, 1, t_randomGenerator);
@@ -132,16 +139,76 @@ namespace ga
 		cout << "Destructor successful!\n\n";
 	}
 
+	/**
+	*	@brief  Checks that advanceGeneration() makes no heap allocations once a GA has warmed up.
+	*	Runs with each combination of double buffering and contiguous
+	*	storage. Requires GA_COUNT_ALLOCATIONS (see AllocationCounter.h).
+	*	The Chromo's own functions are included in the count, so
+	*	they must not allocate either. Works best with ChromoTestFeatures.
+	*
+	*	@return true if no allocations were made, false otherwise
+	*/
+	template <typename C>
+	static bool runAllocationTest(const RandomGenerator t_randomGenerator)
+	{
+		std::cout << "Beginning allocation test...\n";
+		if (!AllocationCounter::isEnabled()) {
+			std::cout << "\nERROR: Allocations are not being counted. Define GA_COUNT_ALLOCATIONS in one source file (see AllocationCounter.h).\n\n";
+			return false;
+		}
+
+		bool isPassed{ true };
+		for (int mode{ 0 }; mode < 4; ++mode)
+		{
+			const bool isDoubleBuffered{ (mode & 1) != 0 };
+			const bool isContiguousStorage{ (mode & 2) != 0 };
+
+			ga::GeneticAlgorithm<C>* gaTest = new ga::GeneticAlgorithm<C>("Allocation test", 100, 1, t_randomGenerator);
+			gaTest->setNumberToCopy(10);
+			gaTest->setNumberToShuffle(20);
+			gaTest->setNumberToCrossover(20);
+			gaTest->setNumberToMutate(40);
+			gaTest->setNumberOfCrossoverSplits(3);
+			gaTest->setMutationCountMax(4);
+			gaTest->setFitnessCacheSize(64);
+			gaTest->setDoubleBuffering(isDoubleBuffered);
+			gaTest->setContiguousStorage(isContiguousStorage);
+
+			// Warm up, so that every buffer reaches its full size
+			for (int g{ 0 }; g < 10; ++g) {
+				gaTest->advanceGeneration();
+			}
+
+			const unsigned long long int countBefore{ AllocationCounter::getCount() };
+			for (int g{ 0 }; g < 50; ++g) {
+				gaTest->advanceGeneration();
+			}
+			const unsigned long long int allocations{ AllocationCounter::getCount() - countBefore };
+			delete gaTest;
+
+			std::cout << "\nDouble buffering " << (isDoubleBuffered ? "on" : "off") <<
+				", contiguous storage " << (isContiguousStorage ? "on" : "off") <<
+				": " << allocations << " allocations in 50 generations\n";
+			if (allocations > 0) {
+				isPassed = false;
+			}
+		}
+
+		std::cout << (isPassed ? "Allocation test passed!\n\n" : "\nERROR: Allocation test failed!\n\n");
+		return isPassed;
+	}
+
 	/**
 	*	@brief  Iterates through a vector, limiting the items
+	*	Also accepts a std::array or a FieldView (see GenomeSchema.h).
 	*
 	*	@param  t_vec specifies the vector to modify
 	*	@param  t_min specifies the minimum value to allow
 	*	@param  t_max specifies the maximum value to allow
 	*	@return void
 	*/
-	template <typename T>
-	static void limitVector(std::vector<T>& t_vec, T const t_min, T const t_max)
+	template <typename V, typename T>
+	static void limitVector(V&& t_vec, T const t_min, T const t_max)
 	{
 		for (std::size_t i{ 0 }; i < t_vec.size(); ++i)
 		{
@@ -159,14 +226,15 @@ namespace ga
 	*	This is useful for data that should be limited to a
 	*	range without having the min and max values be
 	*	overrepresented.
+	*	Also accepts a std::array or a FieldView (see GenomeSchema.h).
 	*
 	*	@param  t_vec specifies the vector to modify
 	*	@param  t_min specifies the minimum value to allow
 	*	@param  t_max specifies the maximum value to allow
 	*	@return void
 	*/
-	template <typename T>
-	static void limitVectorModulo(std::vector<T>& t_vec, T const t_min, T const t_max)
+	template <typename V, typename T>
+	static void limitVectorModulo(V&& t_vec, T const t_min, T const t_max)
 	{
 		const T range{ t_max - t_min + static_cast<T>(1) };
 		for (std::size_t i{ 0 }; i < t_vec.size(); ++i)
@@ -221,7 +289,7 @@ namespace ga
 	*	@return void
 	*/
 	template <typename T>
-	static void getUniqueRandomNumbers(std::vector<T>& t_result, std::size_t t_randomIndexCount, const T t_min, const T t_max, int(*t_randomGenerator)(void))
+	static void getUniqueRandomNumbers(std::vector<T>& t_result, std::size_t t_randomIndexCount, const T t_min, const T t_max, RandomGenerator& t_randomGenerator)
 	{
 		// Using Knuth algorithm
 		// Complexity: O(range) = O(N)
@@ -250,6 +318,71 @@ namespace ga
 		}
 	}
 
+	/**
+	*	@brief  Fills a vector with sorted random unique numbers, without visiting the whole range
+	*	Numbers are drawn, sorted, and duplicates removed, until there
+	*	are enough. This takes O(k log k) time for k numbers, no matter
+	*	how large the range is. If more than half of the range is
+	*	needed, the numbers left out are picked instead, so the number
+	*	of duplicates stays small.
+	*
+	*	t_result is cleared and reused, so this does not allocate
+	*	once t_result has grown to fit the range's numbers.
+	*
+	*	@param  t_result specifies the output vector
+	*	@param  t_randomIndexCount specifies the number of random numbers to generate
+	*	@param  t_min specifies the minimum value to allow
+	*	@param  t_max specifies the end of the range (exclusive)
+	*	@param  t_randomGenerator specifies the random number generator
+	*	@return void
+	*/
+	template <typename T>
+	static void getSortedUniqueRandomNumbers(std::vector<T>& t_result, std::size_t t_randomIndexCount, const T t_min, const T t_max, RandomGenerator& t_randomGenerator)
+	{
+		t_result.clear();
+		const std::size_t range{ t_max > t_min ? static_cast<std::size_t>(t_max - t_min) : 0 };
+		if (t_randomIndexCount > range) {
+			t_randomIndexCount = range;
+		}
+
+		// Pick whichever of the chosen or excluded numbers is smaller
+		const bool isExcluding{ t_randomIndexCount > range / 2 };
+		const std::size_t count{ isExcluding ? range - t_randomIndexCount : t_randomIndexCount };
+
+		while (t_result.size() < count)
+		{
+			const std::size_t sortedSize{ t_result.size() };
+			const std::size_t needed{ count - sortedSize };
+			for (std::size_t i{ 0 }; i < needed; ++i) {
+				t_result.push_back(static_cast<T>(t_randomGenerator.nextIndex(range)) + t_min);
+			}
+			// std::sort does not allocate, unlike std::inplace_merge
+			std::sort(t_result.begin(), t_result.end());
+			t_result.erase(std::unique(t_result.begin(), t_result.end()), t_result.end());
+		}
+
+		if (isExcluding)
+		{
+			// Replace the excluded numbers with every other number in the range
+			// The result holds more than half of the range here, so this is still O(k)
+			const std::size_t excludedCount{ t_result.size() };
+			t_result.resize(excludedCount + t_randomIndexCount);
+			std::size_t excludedId{ 0 };
+			std::size_t outId{ excludedCount };
+			for (std::size_t i{ 0 }; i < range; ++i)
+			{
+				const T value{ static_cast<T>(i) + t_min };
+				if (excludedId < excludedCount && t_result[excludedId] == value) {
+					++excludedId;
+				}
+				else {
+					t_result[outId++] = value;
+				}
+			}
+			t_result.erase(t_result.begin(), t_result.begin() + excludedCount);
+		}
+	}
+
 	/**
 	*	@brief  Finds two random unique numbers
 	*
@@ -261,7 +394,7 @@ namespace ga
 	*	@return void
 	*/
 	template <typename T>
-	static void getTwoUniqueRandomNumbers(T& t_result1, T& t_result2, T t_min, T t_max, int(*t_randomGenerator)(void))
+	static void getTwoUniqueRandomNumbers(T& t_result1, T& t_result2, T t_min, T t_max, RandomGenerator& t_randomGenerator)
 	{
 		if (t_max == t_min) {
 			// Special case where only 1 number is available
@@ -311,19 +444,38 @@ namespace ga
 	}
 
 	/**
-	*	@brief  Converts a string to a number of a given type
+	*	@brief  Overloaded << operator for arrays, in the same format as vectors
+	*
+	*	@param  t_oStream specifies the output stream to write to
+	*	@param  t_array specifies the array to write
+	*	@return output stream
+	*/
+	template <typename T, std::size_t N>
+	static std::ostream& operator << (std::ostream& t_oStream, const std::array<T, N>& t_array)
+	{
+		t_oStream << "<";
+		for (std::size_t i{ 0 }; i < N; ++i)
+		{
+			if (i > 0) {
+				t_oStream << ", ";
+			}
+			t_oStream << t_array[i];
+		}
+		t_oStream << ">";
+		return t_oStream;
+	}
+
+	/**
+	*	@brief  Converts a string to a number of a given type (see bif::Import::parseNumber())
 	*
 	*	@param  t_str specifies the string to convert
 	*	@param  t_num specifies the number to modify
 	*	@return void
 	*/
 	template <typename T>
-	static void stringToNumber(std::string t_str, T& t_num)
+	static void stringToNumber(const std::string& t_str, T& t_num)
 	{
-		// Very inefficient method for converting a string to a number
-		// TODO: Replace with something better
-		std::stringstream soSlow(t_str);
-		soSlow >> t_num;
+		bif::Import::parseNumber(t_str.data(), t_str.data() + t_str.length(), t_num);
 	}
 
 	/**
@@ -348,9 +500,9 @@ namespace ga
 	*	@param  t_randomGenerator specifies the random number generator
 	*	@return random double within the range
 	*/
-	inline double randomRangeDouble(const double t_min, const double t_max, int(*t_randomGenerator)(void))
+	inline double randomRangeDouble(const double t_min, const double t_max, RandomGenerator& t_randomGenerator)
 	{
-		return static_cast<double>(t_randomGenerator()) / RAND_MAX * (t_max - t_min) + t_min;
+		return t_randomGenerator.nextDouble() * (t_max - t_min) + t_min;
 	}
 
 	/**
@@ -362,7 +514,7 @@ namespace ga
 	*	@return random number within the range
 	*/
 	template <typename T>
-	inline T randomRange(const T t_min, const T t_max, int(*t_randomGenerator)(void))
+	inline T randomRange(const T t_min, const T t_max, RandomGenerator& t_randomGenerator)
 	{
 		return static_cast<T>(t_randomGenerator()) % (t_max - t_min) + t_min;
 	}
@@ -0,0 +1,802 @@
+/**
+* @class GenomeSchema.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Generates the data processing of a Chromo from a list of fields
+*
+* A hand-written Chromo repeats its variables in encode(), decode(),
+* getEncodedPartitions(), writeDataToCSV() and readDataFromCSV(). A
+* SchemaChromo instead declares its fields once, as small structs:
+*
+*	struct Sudoku : GenomeField<short int, 16>
+*	{
+*		static const char* name() { return "Sudoku"; }
+*		// Optional bounds, applied by applyLimits()
+*		static constexpr bool isBounded{ true };
+*		static constexpr short int lowerBound() { return 1; }
+*		static constexpr short int upperBound() { return 4; }
+*	};
+*	struct Flags : GenomeBits<6> { static const char* name() { return "Flags"; } };
+*
+*	class ChromoSudoku : public SchemaChromo<GenomeSchema<Sudoku, Flags>> { ... };
+*
+* Values are read and written with getValues<Sudoku>(), which returns a
+* std::array. Offsets and sizes are compile time constants, so encode()
+* and decode() are fixed-size copies that the compiler can unroll.
+* The encoding matches appendEncodedVector() and appendEncodedBoolVector().
+*
+* Mutable fields must come before fixed fields, as mutations only
+* reach the first MutationLimits::bytes of the encoded data.
+*
+* SchemaChromo<S, true> keeps no copy of its values. getValues() instead
+* returns a FieldView (or BitFieldView) of the encoded data itself, so
+* encode() and decode() have nothing to do, and crossovers and mutations
+* change exactly what the fitness function reads. Each field must then be
+* aligned to its type, which is checked at compile time. Put larger types
+* first.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef GENOME_SCHEMA_H_
+#define GENOME_SCHEMA_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Chromo.h"
+
+namespace ga
+{
+	/**
+	*	@brief  A field of Count values of type T, each encoded as sizeof(T) bytes.
+	*	Each value gets its own partition, so mutations and crossovers
+	*	can treat them separately.
+	*/
+	template <typename T, std::size_t Count, bool IsMutable = true>
+	struct GenomeField
+	{
+		static_assert(std::is_arithmetic<T>::value, "GenomeField values must be arithmetic types");
+		static_assert(Count > 0, "GenomeField must contain at least 1 value");
+
+		using type = T;
+		static constexpr std::size_t count{ Count };
+		static constexpr std::size_t bytes{ sizeof(T) * Count };
+		static constexpr std::size_t partitions{ Count };
+		static constexpr bool isMutable{ IsMutable };
+		static constexpr bool isBits{ false };
+		static constexpr bool isBounded{ false };
+
+		static const char* name() { return "Field"; }
+		static constexpr T lowerBound() { return std::numeric_limits<T>::lowest(); }
+		static constexpr T upperBound() { return (std::numeric_limits<T>::max)(); }
+	};
+
+	/**
+	*	@brief  A field of Count bools, packed 8 to a byte.
+	*	The field is a single partition, where each bit is a separate value.
+	*/
+	template <std::size_t Count, bool IsMutable = true>
+	struct GenomeBits
+	{
+		static_assert(Count > 0, "GenomeBits must contain at least 1 value");
+
+		using type = bool;
+		static constexpr std::size_t count{ Count };
+		static constexpr std::size_t bytes{ (Count + 7) / 8 };
+		static constexpr std::size_t partitions{ 1 };
+		static constexpr bool isMutable{ IsMutable };
+		static constexpr bool isBits{ true };
+		static constexpr bool isBounded{ false };
+
+		static const char* name() { return "Bits"; }
+		static constexpr bool lowerBound() { return false; }
+		static constexpr bool upperBound() { return true; }
+	};
+
+	/**
+	*	@brief  A typed view of a field's values, inside a Chromo's encoded data.
+	*	A view is only valid until the encoded data is resized or moved,
+	*	so get a new view from getValues() rather than storing one.
+	*/
+	template <typename T, std::size_t Count>
+	class FieldView
+	{
+	public:
+		using Byte = typename std::conditional<std::is_const<T>::value, const char, char>::type;
+
+		explicit FieldView(Byte* t_data)
+			: m_data(reinterpret_cast<T*>(t_data))
+		{ };
+
+		T& operator[](const std::size_t t_index) const { return m_data[t_index]; };
+		T& at(const std::size_t t_index) const;
+		T* begin() const { return m_data; };
+		T* end() const { return m_data + Count; };
+		T* data() const { return m_data; };
+		static constexpr std::size_t size() { return Count; };
+
+	private:
+		T* m_data;
+	};
+
+	/**
+	*	@brief  Returns a value, after checking that the index is in range.
+	*
+	*	@param  t_index specifies the value to return
+	*	@return Reference to the value
+	*/
+	template <typename T, std::size_t Count>
+	T& FieldView<T, Count>::at(const std::size_t t_index) const
+	{
+		if (t_index >= Count) {
+			throw std::out_of_range("FieldView::at");
+		}
+		return m_data[t_index];
+	}
+
+	/**
+	*	@brief  Refers to a single bit, so a bit can be assigned like a bool.
+	*/
+	class BitReference
+	{
+	public:
+		BitReference(unsigned char* t_byte, const std::size_t t_bit)
+			: m_byte(t_byte),
+			m_mask(static_cast<unsigned char>(1 << t_bit))
+		{ };
+
+		operator bool() const { return (*m_byte & m_mask) != 0; };
+		BitReference& operator=(const bool t_value)
+		{
+			*m_byte = static_cast<unsigned char>(t_value ? (*m_byte | m_mask) : (*m_byte & ~m_mask));
+			return *this;
+		};
+		BitReference& operator=(const BitReference& t_other) { return *this = static_cast<bool>(t_other); };
+
+	private:
+		unsigned char* m_byte;
+		unsigned char m_mask;
+	};
+
+	/**
+	*	@brief  A view of a bit field inside a Chromo's encoded data. See FieldView.
+	*	Bit i is bit (i % 8) of byte (i / 8), as in appendEncodedBoolVector().
+	*/
+	template <std::size_t Count, bool IsConst = false>
+	class BitFieldView
+	{
+	public:
+		using Byte = typename std::conditional<IsConst, const char, char>::type;
+		using Reference = typename std::conditional<IsConst, bool, BitReference>::type;
+
+		explicit BitFieldView(Byte* t_data)
+			: m_data(reinterpret_cast<UnsignedByte*>(t_data))
+		{ };
+
+		Reference operator[](const std::size_t t_index) const { return getReference(t_index, std::integral_constant<bool, IsConst>()); };
+		// The packed bytes, (Count + 7) / 8 of them
+		const unsigned char* data() const { return m_data; };
+		static constexpr std::size_t size() { return Count; };
+
+	private:
+		using UnsignedByte = typename std::conditional<IsConst, const unsigned char, unsigned char>::type;
+
+		bool getReference(const std::size_t t_index, std::true_type) const { return ((m_data[t_index / 8] >> (t_index % 8)) & 0x1) != 0; };
+		BitReference getReference(const std::size_t t_index, std::false_type) const { return BitReference(m_data + t_index / 8, t_index % 8); };
+
+		UnsignedByte* m_data;
+	};
+
+	/**
+	*	@brief  Overloaded << operator for field views, in the same format as vectors
+	*
+	*	@param  t_oStream specifies the output stream to write to
+	*	@param  t_view specifies the view to write
+	*	@return output stream
+	*/
+	template <typename T, std::size_t Count>
+	std::ostream& operator << (std::ostream& t_oStream, const FieldView<T, Count>& t_view)
+	{
+		t_oStream << "<";
+		for (std::size_t i{ 0 }; i < Count; ++i)
+		{
+			if (i > 0) {
+				t_oStream << ", ";
+			}
+			t_oStream << t_view[i];
+		}
+		t_oStream << ">";
+		return t_oStream;
+	}
+
+	template <std::size_t Count, bool IsConst>
+	std::ostream& operator << (std::ostream& t_oStream, const BitFieldView<Count, IsConst>& t_view)
+	{
+		t_oStream << "<";
+		for (std::size_t i{ 0 }; i < Count; ++i)
+		{
+			if (i > 0) {
+				t_oStream << ", ";
+			}
+			t_oStream << static_cast<bool>(t_view[i]);
+		}
+		t_oStream << ">";
+		return t_oStream;
+	}
+
+	// Compile time sums and searches over a list of fields
+	namespace schema
+	{
+		template <typename... Fields>
+		struct TotalBytes { static constexpr std::size_t value{ 0 }; };
+		template <typename F, typename... Rest>
+		struct TotalBytes<F, Rest...> { static constexpr std::size_t value{ F::bytes + TotalBytes<Rest...>::value }; };
+
+		template <typename... Fields>
+		struct MutableBytes { static constexpr std::size_t value{ 0 }; };
+		template <typename F, typename... Rest>
+		struct MutableBytes<F, Rest...> { static constexpr std::size_t value{ (F::isMutable ? F::bytes : 0) + MutableBytes<Rest...>::value }; };
+
+		template <typename... Fields>
+		struct MutablePartitions { static constexpr std::size_t value{ 0 }; };
+		template <typename F, typename... Rest>
+		struct MutablePartitions<F, Rest...> { static constexpr std::size_t value{ (F::isMutable ? F::partitions : 0) + MutablePartitions<Rest...>::value }; };
+
+		// Byte offset of field I
+		template <std::size_t I, typename... Fields>
+		struct Offset;
+		template <typename F, typename... Rest>
+		struct Offset<0, F, Rest...> { static constexpr std::size_t value{ 0 }; };
+		template <std::size_t I, typename F, typename... Rest>
+		struct Offset<I, F, Rest...> { static constexpr std::size_t value{ F::bytes + Offset<I - 1, Rest...>::value }; };
+
+		// Position of field F in the list
+		template <typename F, typename... Fields>
+		struct IndexOf;
+		template <typename F, typename... Rest>
+		struct IndexOf<F, F, Rest...> { static constexpr std::size_t value{ 0 }; };
+		template <typename F, typename G, typename... Rest>
+		struct IndexOf<F, G, Rest...> { static constexpr std::size_t value{ 1 + IndexOf<F, Rest...>::value }; };
+
+		// True if no mutable field follows a fixed field
+		template <typename... Fields>
+		struct IsMutableFirst { static constexpr bool value{ true }; };
+		template <typename F, typename G, typename... Rest>
+		struct IsMutableFirst<F, G, Rest...> { static constexpr bool value{ (F::isMutable || !G::isMutable) && IsMutableFirst<G, Rest...>::value }; };
+
+		// True if every field, starting at Offset, is aligned to its type
+		template <std::size_t Offset, typename... Fields>
+		struct IsAligned { static constexpr bool value{ true }; };
+		template <std::size_t Offset, typename F, typename... Rest>
+		struct IsAligned<Offset, F, Rest...> { static constexpr bool value{ Offset % alignof(typename F::type) == 0 && IsAligned<Offset + F::bytes, Rest...>::value }; };
+
+		// The type returned by SchemaChromo::getValues()
+		template <typename F, bool IsView, bool IsBits = F::isBits>
+		struct Access
+		{
+			using type = std::array<typename F::type, F::count>&;
+			using constType = const std::array<typename F::type, F::count>&;
+		};
+		template <typename F>
+		struct Access<F, true, false>
+		{
+			using type = FieldView<typename F::type, F::count>;
+			using constType = FieldView<const typename F::type, F::count>;
+		};
+		template <typename F>
+		struct Access<F, true, true>
+		{
+			using type = BitFieldView<F::count>;
+			using constType = BitFieldView<F::count, true>;
+		};
+
+		// Reads CSV values that were already split into strings, like bif::CSVCursor reads a line
+		class StringVectorReader
+		{
+		public:
+			explicit StringVectorReader(const std::vector<std::string>& t_values)
+				: m_values(t_values)
+			{ };
+
+			template <typename T>
+			bool read(T& t_value)
+			{
+				const std::string& value{ m_values.at(m_valueId++) };
+				return bif::Import::parseNumber(value.data(), value.data() + value.length(), t_value);
+			}
+			bool readBool(bool& t_value)
+			{
+				t_value = (m_values.at(m_valueId++) == "T");
+				return true;
+			}
+
+		private:
+			const std::vector<std::string>& m_values;
+			std::size_t m_valueId{ 0 };
+		};
+	} // namespace schema
+
+	/**
+	*	@brief  An ordered list of fields, with offsets and sizes known at compile time.
+	*/
+	template <typename... Fields>
+	struct GenomeSchema
+	{
+		static_assert(sizeof...(Fields) > 0, "GenomeSchema must contain at least 1 field");
+		static_assert(schema::IsMutableFirst<Fields...>::value, "Mutable fields must come before fixed fields");
+
+		// Storage for every field, in order
+		using Values = std::tuple<std::array<typename Fields::type, Fields::count>...>;
+		using Indices = std::make_index_sequence<sizeof...(Fields)>;
+
+		template <std::size_t I>
+		using Field = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+		template <std::size_t I>
+		struct Offset { static constexpr std::size_t value{ schema::Offset<I, Fields...>::value }; };
+		template <typename F>
+		struct IndexOf { static constexpr std::size_t value{ schema::IndexOf<F, Fields...>::value }; };
+
+		static constexpr std::size_t fieldCount{ sizeof...(Fields) };
+		static constexpr std::size_t bytes{ schema::TotalBytes<Fields...>::value };
+		static constexpr std::size_t mutableBytes{ schema::MutableBytes<Fields...>::value };
+		static constexpr std::size_t mutablePartitions{ schema::MutablePartitions<Fields...>::value };
+		static constexpr bool isAligned{ schema::IsAligned<0, Fields...>::value };
+	};
+
+	/**
+	*	@brief  A Chromo whose data processing is generated from a GenomeSchema.
+	*	Derived classes still write initializeValues(), the fitness function,
+	*	mutateCustom() and hasCustomMutations(). They may hide applyLimits()
+	*	to replace the bounds checks.
+	*
+	*	If IsView is true, values are views of the encoded data rather than copies.
+	*/
+	template <typename S, bool IsView = false>
+	class SchemaChromo : public Chromo
+	{
+		static_assert(!IsView || S::isAligned, "Each field of a view Chromo must be aligned to its type. Put larger types first.");
+
+	public:
+		using Schema = S;
+
+		explicit SchemaChromo(const int t_initialStateId, const RandomGenerator& t_randomGenerator)
+			: Chromo(t_initialStateId, t_randomGenerator)
+		{
+			// Views need the encoded data to exist before any values are set
+			m_encoded.resize(S::bytes);
+		};
+		virtual ~SchemaChromo() {};
+
+		template <typename F>
+		typename schema::Access<F, IsView>::type getValues();
+		template <typename F>
+		typename schema::Access<F, IsView>::constType getValues() const;
+
+		void encode();
+		void decode();
+		void applyLimits();
+
+		static void getEncodedPartitions(std::vector<EncodedPartition>&, MutationLimits&);
+
+	protected:
+		void writeDataToCSV(std::ostream&);
+		void writeDataToCSV(bif::CSVBuffer&);
+		void readDataFromCSV(std::vector<std::string>&);
+		void readDataFromCSV(bif::CSVCursor&);
+
+	private:
+		// The std::integral_constant argument selects the version for views
+		template <typename F>
+		typename schema::Access<F, IsView>::type getStoredValues(std::false_type);
+		template <typename F>
+		typename schema::Access<F, IsView>::type getStoredValues(std::true_type);
+		template <typename F>
+		typename schema::Access<F, IsView>::constType getStoredValues(std::false_type) const;
+		template <typename F>
+		typename schema::Access<F, IsView>::constType getStoredValues(std::true_type) const;
+		void copyValuesToEncoded(std::false_type);
+		void copyValuesToEncoded(std::true_type) {};
+		void copyValuesFromEncoded(std::false_type);
+		void copyValuesFromEncoded(std::true_type) {};
+
+		// Each function below handles a single field
+		// The std::integral_constant argument selects the version for bit fields or bounded fields
+		template <std::size_t I>
+		void encodeField(char*, std::false_type) const;
+		template <std::size_t I>
+		void encodeField(char*, std::true_type) const;
+		template <std::size_t I>
+		void decodeField(const char*, std::false_type);
+		template <std::size_t I>
+		void decodeField(const char*, std::true_type);
+		template <std::size_t I>
+		void writeFieldToCSV(bif::CSVBuffer&, std::false_type) const;
+		template <std::size_t I>
+		void writeFieldToCSV(bif::CSVBuffer&, std::true_type) const;
+		template <std::size_t I, typename R>
+		void readFieldFromCSV(R&, std::false_type);
+		template <std::size_t I, typename R>
+		void readFieldFromCSV(R&, std::true_type);
+		template <std::size_t I>
+		void applyFieldLimits(std::false_type) {};
+		template <std::size_t I>
+		void applyFieldLimits(std::true_type);
+		template <std::size_t I>
+		static void addFieldPartitions(std::vector<EncodedPartition>&, MutationLimits&, std::size_t&, std::false_type);
+		template <std::size_t I>
+		static void addFieldPartitions(std::vector<EncodedPartition>&, MutationLimits&, std::size_t&, std::true_type);
+
+		template <std::size_t... I>
+		void encodeFields(char*, std::index_sequence<I...>) const;
+		template <std::size_t... I>
+		void decodeFields(const char*, std::index_sequence<I...>);
+		template <std::size_t... I>
+		void writeFieldsToCSV(bif::CSVBuffer&, std::index_sequence<I...>) const;
+		template <typename R, std::size_t... I>
+		void readFieldsFromCSV(R&, std::index_sequence<I...>);
+		template <std::size_t... I>
+		void applyFieldsLimits(std::index_sequence<I...>);
+		template <std::size_t... I>
+		static void addFieldsPartitions(std::vector<EncodedPartition>&, MutationLimits&, std::size_t&, std::index_sequence<I...>);
+
+		// Views store nothing here
+		typename std::conditional<IsView, std::tuple<>, typename S::Values>::type m_values{};
+	};
+
+	/**
+	*	@brief  Returns the values of a field, for reading or writing.
+	*	Returns a std::array, or a view of the encoded data if IsView is true.
+	*	Call markVariablesChanged() after writing, so the Chromo is encoded
+	*	and scored again.
+	*
+	*	@return The field's values
+	*/
+	template <typename S, bool IsView>
+	template <typename F>
+	typename schema::Access<F, IsView>::type SchemaChromo<S, IsView>::getValues()
+	{
+		return getStoredValues<F>(std::integral_constant<bool, IsView>());
+	}
+
+	template <typename S, bool IsView>
+	template <typename F>
+	typename schema::Access<F, IsView>::constType SchemaChromo<S, IsView>::getValues() const
+	{
+		return getStoredValues<F>(std::integral_constant<bool, IsView>());
+	}
+
+	template <typename S, bool IsView>
+	template <typename F>
+	typename schema::Access<F, IsView>::type SchemaChromo<S, IsView>::getStoredValues(std::false_type)
+	{
+		return std::get<S::template IndexOf<F>::value>(m_values);
+	}
+
+	template <typename S, bool IsView>
+	template <typename F>
+	typename schema::Access<F, IsView>::type SchemaChromo<S, IsView>::getStoredValues(std::true_type)
+	{
+		using View = typename schema::Access<F, IsView>::type;
+		return View(m_encoded.data() + S::template Offset<S::template IndexOf<F>::value>::value);
+	}
+
+	template <typename S, bool IsView>
+	template <typename F>
+	typename schema::Access<F, IsView>::constType SchemaChromo<S, IsView>::getStoredValues(std::false_type) const
+	{
+		return std::get<S::template IndexOf<F>::value>(m_values);
+	}
+
+	template <typename S, bool IsView>
+	template <typename F>
+	typename schema::Access<F, IsView>::constType SchemaChromo<S, IsView>::getStoredValues(std::true_type) const
+	{
+		using View = typename schema::Access<F, IsView>::constType;
+		return View(m_encoded.data() + S::template Offset<S::template IndexOf<F>::value>::value);
+	}
+
+	/**
+	*	@brief  Converts every field into the encoded data, at its fixed offset.
+	*	Views are already in the encoded data, so only the size is checked.
+	*
+	*	@return void
+	*/
+	template <typename S, bool IsView>
+	void SchemaChromo<S, IsView>::encode()
+	{
+		m_encoded.resize(S::bytes);
+		copyValuesToEncoded(std::integral_constant<bool, IsView>());
+	}
+
+	/**
+	*	@brief  Converts the encoded data back into every field.
+	*	Views read the encoded data directly, so only the size is checked.
+	*
+	*	@return void
+	*/
+	template <typename S, bool IsView>
+	void SchemaChromo<S, IsView>::decode()
+	{
+		if (m_encoded.length() >= S::bytes) {
+			copyValuesFromEncoded(std::integral_constant<bool, IsView>());
+		}
+		else {
+			std::cout << "\nERROR: Encoded data is shorter than the genome schema.\n\n";
+		}
+	}
+
+	template <typename S, bool IsView>
+	void SchemaChromo<S, IsView>::copyValuesToEncoded(std::false_type)
+	{
+		encodeFields(m_encoded.data(), typename S::Indices());
+	}
+
+	template <typename S, bool IsView>
+	void SchemaChromo<S, IsView>::copyValuesFromEncoded(std::false_type)
+	{
+		decodeFields(m_encoded.data(), typename S::Indices());
+	}
+
+	/**
+	*	@brief  Clamps the values of every bounded field to [lowerBound(), upperBound()].
+	*
+	*	@return void
+	*/
+	template <typename S, bool IsView>
+	void SchemaChromo<S, IsView>::applyLimits()
+	{
+		applyFieldsLimits(typename S::Indices());
+	}
+
+	/**
+	*	@brief  This is a static function used by GeneticAlgorithm.h to obtain the data partitions within the encoded chromosome.
+	*
+	*	@param  t_encodedPartitions specifies the vector of partitions to be modified
+	*   @param  t_mutationLimits specifies the bytes and partitions allowed for the crossover and mutation phases
+	*	@return void
+	*/
+	template <typename S, bool IsView>
+	void SchemaChromo<S, IsView>::getEncodedPartitions(std::vector<EncodedPartition>& t_encodedPartitions, MutationLimits& t_mutationLimits)
+	{
+		t_encodedPartitions.clear();
+		std::size_t location{ 0 };
+		t_mutationLimits.bytes = 0;
+		t_mutationLimits.partitions = 0;
+		addFieldsPartitions(t_encodedPartitions, t_mutationLimits, location, typename S::Indices());
+	}
+
+	/**
+	*	@brief  Writes every field to a CSV file stream. Bits are written as T or F.
+	*
+	*	@param  t_oStream specifies the file stream to write to
+	*	@return void
+	*/
+	template <typename S, bool IsView>
+	void SchemaChromo<S, IsView>::writeDataToCSV(std::ostream& t_oStream)
+	{
+		writeBufferedDataToCSV(t_oStream);
+	}
+
+	/**
+	*	@brief  Writes every field straight into a CSV line, without a stream. Bits are written as T or F.
+	*
+	*	@param  t_buffer specifies the line, after the ID and score
+	*	@return void
+	*/
+	template <typename S, bool IsView>
+	void SchemaChromo<S, IsView>::writeDataToCSV(bif::CSVBuffer& t_buffer)
+	{
+		writeFieldsToCSV(t_buffer, typename S::Indices());
+	}
+
+	/**
+	*	@brief  Reads every field from a CSV line.
+	*
+	*	@param  t_chromoValues is a vector of strings containing the CSV row values
+	*	@return void
+	*/
+	template <typename S, bool IsView>
+	void SchemaChromo<S, IsView>::readDataFromCSV(std::vector<std::string>& t_chromoValues)
+	{
+		schema::StringVectorReader reader(t_chromoValues);
+		readFieldsFromCSV(reader, typename S::Indices());
+	}
+
+	/**
+	*	@brief  Reads every field straight from a CSV line, without splitting it into strings.
+	*
+	*	@param  t_cursor specifies the line, positioned at the first field's values
+	*	@return void
+	*/
+	template <typename S, bool IsView>
+	void SchemaChromo<S, IsView>::readDataFromCSV(bif::CSVCursor& t_cursor)
+	{
+		readFieldsFromCSV(t_cursor, typename S::Indices());
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t... I>
+	void SchemaChromo<S, IsView>::encodeFields(char* t_encoded, std::index_sequence<I...>) const
+	{
+		// Calls encodeField() once per field, in order
+		// An initializer list is used, as C++14 has no fold expressions
+		using expand = int[];
+		(void)expand{ 0, (encodeField<I>(t_encoded + S::template Offset<I>::value, std::integral_constant<bool, S::template Field<I>::isBits>()), 0)... };
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t... I>
+	void SchemaChromo<S, IsView>::decodeFields(const char* t_encoded, std::index_sequence<I...>)
+	{
+		using expand = int[];
+		(void)expand{ 0, (decodeField<I>(t_encoded + S::template Offset<I>::value, std::integral_constant<bool, S::template Field<I>::isBits>()), 0)... };
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t... I>
+	void SchemaChromo<S, IsView>::writeFieldsToCSV(bif::CSVBuffer& t_buffer, std::index_sequence<I...>) const
+	{
+		using expand = int[];
+		(void)expand{ 0, (writeFieldToCSV<I>(t_buffer, std::integral_constant<bool, S::template Field<I>::isBits>()), 0)... };
+	}
+
+	template <typename S, bool IsView>
+	template <typename R, std::size_t... I>
+	void SchemaChromo<S, IsView>::readFieldsFromCSV(R& t_reader, std::index_sequence<I...>)
+	{
+		using expand = int[];
+		(void)expand{ 0, (readFieldFromCSV<I>(t_reader, std::integral_constant<bool, S::template Field<I>::isBits>()), 0)... };
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t... I>
+	void SchemaChromo<S, IsView>::applyFieldsLimits(std::index_sequence<I...>)
+	{
+		using expand = int[];
+		(void)expand{ 0, (applyFieldLimits<I>(std::integral_constant<bool, S::template Field<I>::isBounded>()), 0)... };
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t... I>
+	void SchemaChromo<S, IsView>::addFieldsPartitions(std::vector<EncodedPartition>& t_encodedPartitions, MutationLimits& t_mutationLimits, std::size_t& t_location, std::index_sequence<I...>)
+	{
+		using expand = int[];
+		(void)expand{ 0, (addFieldPartitions<I>(t_encodedPartitions, t_mutationLimits, t_location, std::integral_constant<bool, S::template Field<I>::isBits>()), 0)... };
+	}
+
+	/**
+	*	@brief  Copies the raw bytes of a value field, as appendEncodedVector() does.
+	*/
+	template <typename S, bool IsView>
+	template <std::size_t I>
+	void SchemaChromo<S, IsView>::encodeField(char* t_encoded, std::false_type) const
+	{
+		std::memcpy(t_encoded, std::get<I>(m_values).data(), S::template Field<I>::bytes);
+	}
+
+	/**
+	*	@brief  Packs a bit field 8 bools to a byte, as appendEncodedBoolVector() does.
+	*/
+	template <typename S, bool IsView>
+	template <std::size_t I>
+	void SchemaChromo<S, IsView>::encodeField(char* t_encoded, std::true_type) const
+	{
+		using F = typename S::template Field<I>;
+		const auto& values = std::get<I>(m_values);
+		unsigned char packed[F::bytes]{};
+		for (std::size_t i{ 0 }; i < F::count; ++i) {
+			packed[i / 8] |= static_cast<unsigned char>(values[i] ? 1 : 0) << (i % 8);
+		}
+		std::memcpy(t_encoded, packed, F::bytes);
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t I>
+	void SchemaChromo<S, IsView>::decodeField(const char* t_encoded, std::false_type)
+	{
+		std::memcpy(std::get<I>(m_values).data(), t_encoded, S::template Field<I>::bytes);
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t I>
+	void SchemaChromo<S, IsView>::decodeField(const char* t_encoded, std::true_type)
+	{
+		using F = typename S::template Field<I>;
+		auto& values = std::get<I>(m_values);
+		for (std::size_t i{ 0 }; i < F::count; ++i) {
+			values[i] = ((t_encoded[i / 8] >> (i % 8)) & 0x1) != 0;
+		}
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t I>
+	void SchemaChromo<S, IsView>::writeFieldToCSV(bif::CSVBuffer& t_buffer, std::false_type) const
+	{
+		using F = typename S::template Field<I>;
+		auto&& values = getValues<F>();
+		for (std::size_t i{ 0 }; i < values.size(); ++i) {
+			t_buffer.write(static_cast<typename F::type>(values[i]));
+		}
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t I>
+	void SchemaChromo<S, IsView>::writeFieldToCSV(bif::CSVBuffer& t_buffer, std::true_type) const
+	{
+		auto&& values = getValues<typename S::template Field<I>>();
+		for (std::size_t i{ 0 }; i < values.size(); ++i) {
+			t_buffer.writeBool(values[i]);
+		}
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t I, typename R>
+	void SchemaChromo<S, IsView>::readFieldFromCSV(R& t_reader, std::false_type)
+	{
+		auto&& values = getValues<typename S::template Field<I>>();
+		for (std::size_t i{ 0 }; i < values.size(); ++i) {
+			t_reader.read(values[i]);
+		}
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t I, typename R>
+	void SchemaChromo<S, IsView>::readFieldFromCSV(R& t_reader, std::true_type)
+	{
+		auto&& values = getValues<typename S::template Field<I>>();
+		for (std::size_t i{ 0 }; i < values.size(); ++i)
+		{
+			bool value;
+			t_reader.readBool(value);
+			values[i] = value;
+		}
+	}
+
+	template <typename S, bool IsView>
+	template <std::size_t I>
+	void SchemaChromo<S, IsView>::applyFieldLimits(std::true_type)
+	{
+		using F = typename S::template Field<I>;
+		auto&& values = getValues<F>();
+		for (std::size_t i{ 0 }; i < values.size(); ++i) {
+			values[i] = clamp<typename F::type>(values[i], F::lowerBound(), F::upperBound());
+		}
+	}
+
+	/**
+	*	@brief  Adds a partition for each value of a value field.
+	*/
+	template <typename S, bool IsView>
+	template <std::size_t I>
+	void SchemaChromo<S, IsView>::addFieldPartitions(std::vector<EncodedPartition>& t_encodedPartitions, MutationLimits& t_mutationLimits, std::size_t& t_location, std::false_type)
+	{
+		using F = typename S::template Field<I>;
+		Chromo::addItemIndicesOfVector(t_encodedPartitions, t_mutationLimits, t_location, sizeof(typename F::type), F::count, F::name(), F::isMutable);
+	}
+
+	/**
+	*	@brief  Adds a single partition for a bit field.
+	*/
+	template <typename S, bool IsView>
+	template <std::size_t I>
+	void SchemaChromo<S, IsView>::addFieldPartitions(std::vector<EncodedPartition>& t_encodedPartitions, MutationLimits& t_mutationLimits, std::size_t& t_location, std::true_type)
+	{
+		using F = typename S::template Field<I>;
+		Chromo::addItemIndicesOfBoolVector(t_encodedPartitions, t_mutationLimits, t_location, F::count, F::name(), F::isMutable);
+	}
+
+} // namespace ga
+
+#endif	// GENOME_SCHEMA_H_
@@ -4,6 +4,15 @@
 * @date December 26, 2017
 * @brief Contains static functions to aid in import/export of files
 *
+* CSV lines can be read without building a std::string per value:
+* CSVCursor walks a line in place, handing out TokenViews (a pointer and
+* a length into the line), and parseNumber() converts a token without a
+* stringstream.
+*
+* CSV lines are written the same way in reverse: CSVBuffer builds lines in
+* one reusable block of memory, and formatNumber() writes each number
+* straight into it, like std::to_chars.
+*
 * @see (link to GitHub)
 */
 
@@ -20,10 +29,76 @@
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <cerrno>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#include "FloatFormat.h"
 
 // Amazingly clever namespace name
 namespace bif
 {
+	// Part of a string, which is not copied
+	// The string must outlive the view
+	class TokenView
+	{
+	public:
+		TokenView() {};
+		TokenView(const char* t_data, const std::size_t t_length)
+			: m_data(t_data), m_length(t_length)
+		{ };
+
+		const char* data() const { return m_data; }
+		std::size_t size() const { return m_length; }
+		std::size_t length() const { return m_length; }
+		bool empty() const { return m_length == 0; }
+		const char* begin() const { return m_data; }
+		const char* end() const { return m_data + m_length; }
+		std::string toString() const { return std::string(m_data, m_length); }
+
+		/**
+		*	@brief  Compares the token to a null terminated string
+		*
+		*	@param  t_other specifies the string to compare with
+		*	@return true if the characters are the same
+		*/
+		bool operator==(const char* t_other) const
+		{
+			const std::size_t otherLength{ std::strlen(t_other) };
+			return otherLength == m_length && std::memcmp(m_data, t_other, m_length) == 0;
+		}
+		bool operator!=(const char* t_other) const
+		{
+			return !(*this == t_other);
+		}
+
+		/**
+		*	@brief  Returns the token without certain characters at its start and end
+		*
+		*	@param  t_removeChar specifies the character to remove (defaults to ' ')
+		*	@return Shorter view of the same characters
+		*/
+		TokenView trim(const char t_removeChar = ' ') const
+		{
+			const char* first{ m_data };
+			const char* last{ m_data + m_length };
+			while (first != last && *first == t_removeChar)
+				++first;
+			while (last != first && *(last - 1) == t_removeChar)
+				--last;
+			return TokenView(first, static_cast<std::size_t>(last - first));
+		}
+
+	private:
+		const char* m_data{ nullptr };
+		std::size_t m_length{ 0 };
+	};
+
 	class Import
 	{
 	public:
@@ -111,6 +186,50 @@ namespace bif
 			return ret;
 		}
 
+		/**
+		*	@brief  Converts characters to a number, without a stringstream
+		*	Like reading the number from a stream, leading whitespace is
+		*	skipped and anything after the number is ignored. chars are
+		*	read as a single character, and bools as 0 or 1. Integers out
+		*	of range are clamped. If no number is found, t_value is set to 0.
+		*
+		*	@param  t_first points to the first character
+		*	@param  t_last points one past the last character
+		*	@param  t_value is set to the number
+		*	@return true if a number was read, false otherwise
+		*/
+		template <typename T>
+		static bool parseNumber(const char* t_first, const char* t_last, T& t_value)
+		{
+			return parseNumber(t_first, t_last, t_value, NumberKind<T>());
+		}
+
+		template <typename T>
+		static bool parseNumber(const TokenView t_token, T& t_value)
+		{
+			return parseNumber(t_token.begin(), t_token.end(), t_value);
+		}
+
+		// Most characters formatNumber() writes for any number
+		static const std::size_t maxNumberLength{ 48 };
+
+		/**
+		*	@brief  Writes a number as characters, without a stream, like std::to_chars
+		*	Integers are written digit by digit. Floats are written with as
+		*	few digits as read back to the same value, and whole floats are
+		*	written as integers. chars are written as a single character,
+		*	and bools as 0 or 1, so parseNumber() reads every value back.
+		*
+		*	@param  t_first points to space for at least maxNumberLength characters
+		*	@param  t_value specifies the number
+		*	@return Pointer one past the last character written (no null is added)
+		*/
+		template <typename T>
+		static char* formatNumber(char* t_first, const T t_value)
+		{
+			return formatNumber(t_first, t_value, NumberKind<T>());
+		}
+
 		/**
 		*	@brief  Converts a vector of strings to a vector of another type, erasing those string items
 		*	The user must specify the number of items to convert. This
@@ -124,15 +243,14 @@ namespace bif
 		template <typename T>
 		static std::vector<T> vectorStringToVector(std::vector<std::string>& t_stringVec, const std::size_t t_count)
 		{
-			std::vector<T> result;
+			std::vector<T> result(t_count);
 			for (std::size_t iter{ 0 }; iter < t_count; ++iter)
 			{
-				T number;
-				std::stringstream ss(t_stringVec.at(0));
-				ss >> number;
-				result.push_back(number);
-				t_stringVec.erase(t_stringVec.begin());
+				const std::string& item{ t_stringVec.at(iter) };
+				parseNumber(item.data(), item.data() + item.length(), result[iter]);
 			}
+			// Erase every converted item at once, rather than one at a time from the front
+			t_stringVec.erase(t_stringVec.begin(), t_stringVec.begin() + t_count);
 			return result;
 		}
 
@@ -148,17 +266,12 @@ namespace bif
 		*/
 		static std::vector<bool> vectorStringToBoolVector(std::vector<std::string>& t_stringVec, const std::size_t t_count)
 		{
-			std::vector<bool> result;
+			std::vector<bool> result(t_count);
 			for (std::size_t iter{ 0 }; iter < t_count; ++iter)
 			{
-				if (t_stringVec.at(0).compare("T")) {
-					result.push_back(true);
-				}
-				else {
-					result.push_back(false);
-				}
-				t_stringVec.erase(t_stringVec.begin());
+				result[iter] = (t_stringVec.at(iter) == "T");
 			}
+			t_stringVec.erase(t_stringVec.begin(), t_stringVec.begin() + t_count);
 			return result;
 		}
 
@@ -176,35 +289,28 @@ namespace bif
 		static std::vector<std::string> parseString(std::string const t_input, std::string const t_delimiter, CleanTokenBy const t_cleanTokenBy = CleanTokenBy::trimSpaces)
 		{
 			std::vector<std::string> parsedItems;
+			if (t_delimiter.empty()) {
+				parsedItems.push_back(t_cleanTokenBy == CleanTokenBy::trimSpaces ? trim(t_input) : t_input);
+				return parsedItems;
+			}
 
-			// Prepare positions, ensuring we use correct std::size_t
-			auto nextToken = decltype(t_input.size()) {0};
-			auto lastToken = decltype(nextToken) {0};
-			const auto num0 = decltype(nextToken) {0};
-			const auto num1 = decltype(nextToken) {1};
-
-			// Token must be outsize loop scope in order to handle last token
-			std::string token;
-
-			// Iterate through string looking for tokens
-			while ((nextToken = t_input.find(t_delimiter, lastToken + num1)) != std::string::npos)
+			// Walk the string once, copying each token straight into the result
+			const char* position{ t_input.data() };
+			const char* const last{ t_input.data() + t_input.length() };
+			while (true)
 			{
-				const auto tokenStartPos = decltype(nextToken) { lastToken == 0 ? num0 : lastToken + num1 };
-				token = t_input.substr(tokenStartPos, nextToken - tokenStartPos);
+				const char* tokenEnd{ std::search(position, last, t_delimiter.begin(), t_delimiter.end()) };
+				TokenView token(position, static_cast<std::size_t>(tokenEnd - position));
 
 				// Apply string functions
 				if (t_cleanTokenBy == CleanTokenBy::trimSpaces)
-					token = trim(token);
-				parsedItems.push_back(token);
-				lastToken = nextToken;
-			}
+					token = token.trim();
+				parsedItems.emplace_back(token.begin(), token.end());
 
-			// Add last token, if it exists
-			token = t_input.substr(lastToken + num1, nextToken - lastToken - num1);
-			// Apply string functions
-			if (t_cleanTokenBy == CleanTokenBy::trimSpaces)
-				token = trim(token);
-			parsedItems.push_back(token);
+				if (tokenEnd == last)
+					break;
+				position = tokenEnd + t_delimiter.length();
+			}
 
 			return parsedItems;
 		}
@@ -244,10 +350,15 @@ namespace bif
 		template <typename T>
 		static void writeVectorToCSVStream(std::ostream& t_oStream, const std::vector<T>& t_vec)
 		{
-			const auto itemCount{ t_vec.size() };
-			for (auto i = decltype(itemCount) {0}; i < itemCount; ++i) {
-				t_oStream << "," << t_vec.at(i);
+			// Format every value first, then write them all at once
+			std::string text(t_vec.size() * (maxNumberLength + 1), '\0');
+			char* position{ &text[0] };
+			for (std::size_t i{ 0 }; i < t_vec.size(); ++i)
+			{
+				*position++ = ',';
+				position = formatNumber(position, static_cast<T>(t_vec[i]));
 			}
+			t_oStream.write(text.data(), position - text.data());
 		}
 
 		/**
@@ -259,10 +370,11 @@ namespace bif
 		*/
 		static void writeBoolVectorToCSVStream(std::ostream& t_oStream, const std::vector<bool>& t_vec)
 		{
-			const auto itemCount{ t_vec.size() };
-			for (auto i = decltype(itemCount) {0}; i < itemCount; ++i) {
-				t_oStream << "," << (t_vec.at(i) ? "T" : "F");
+			std::string text(t_vec.size() * 2, ',');
+			for (std::size_t i{ 0 }; i < t_vec.size(); ++i) {
+				text[i * 2 + 1] = t_vec[i] ? 'T' : 'F';
 			}
+			t_oStream.write(text.data(), text.size());
 		}
 
 		/**
@@ -309,6 +421,555 @@ namespace bif
 			std::cout << '\n';
 		}
 
+	private:
+		// Kinds of number, so parseNumber() can choose a conversion at compile time
+		enum class NumberKindId { integer, floatingPoint, character, boolean };
+		template <typename T>
+		using NumberKind = std::integral_constant<NumberKindId,
+			std::is_same<T, bool>::value ? NumberKindId::boolean :
+			(std::is_same<T, char>::value || std::is_same<T, signed char>::value || std::is_same<T, unsigned char>::value) ? NumberKindId::character :
+			std::is_floating_point<T>::value ? NumberKindId::floatingPoint : NumberKindId::integer>;
+
+		static const char* skipWhitespace(const char* t_first, const char* t_last)
+		{
+			while (t_first != t_last && (*t_first == ' ' || *t_first == '\t' || *t_first == '\r' || *t_first == '\n'))
+				++t_first;
+			return t_first;
+		}
+
+		/**
+		*	@brief  Reads decimal digits, clamping the result to the range of T.
+		*/
+		template <typename T>
+		static bool parseNumber(const char* t_first, const char* t_last, T& t_value, std::integral_constant<NumberKindId, NumberKindId::integer>)
+		{
+			using Unsigned = typename std::make_unsigned<T>::type;
+			t_value = 0;
+			const char* position{ skipWhitespace(t_first, t_last) };
+
+			bool isNegative{ false };
+			if (position != t_last && (*position == '-' || *position == '+'))
+			{
+				isNegative = (*position == '-');
+				++position;
+			}
+
+			// Largest magnitude allowed, as -min is one more than max
+			// Negative unsigned numbers wrap around, as with strtoul()
+			const Unsigned maxMagnitude{ static_cast<Unsigned>(static_cast<Unsigned>(std::numeric_limits<T>::max()) + (isNegative && std::is_signed<T>::value ? 1 : 0)) };
+			Unsigned magnitude{ 0 };
+			bool isClamped{ false };
+			const char* const firstDigit{ position };
+			for (; position != t_last && *position >= '0' && *position <= '9'; ++position)
+			{
+				const Unsigned digit{ static_cast<Unsigned>(*position - '0') };
+				if (magnitude > (maxMagnitude - digit) / 10) {
+					magnitude = maxMagnitude;
+					isClamped = true;
+				}
+				else if (!isClamped) {
+					magnitude = static_cast<Unsigned>(magnitude * 10 + digit);
+				}
+			}
+			if (position == firstDigit) {
+				return false;
+			}
+
+			if (isClamped) {
+				t_value = isNegative && std::is_signed<T>::value ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+				return false;
+			}
+			t_value = isNegative ? static_cast<T>(0 - magnitude) : static_cast<T>(magnitude);
+			return true;
+		}
+
+		/**
+		*	@brief  Reads a float with strtod() (or strtof() / strtold()), from a null terminated copy of the characters.
+		*	Numbers too large for T are clamped, rather than becoming infinity.
+		*/
+		template <typename T>
+		static bool parseNumber(const char* t_first, const char* t_last, T& t_value, std::integral_constant<NumberKindId, NumberKindId::floatingPoint>)
+		{
+			t_value = 0;
+			const char* const first{ skipWhitespace(t_first, t_last) };
+			const std::size_t length{ static_cast<std::size_t>(t_last - first) };
+
+			// Most numbers fit in the buffer, so no memory is allocated
+			char buffer[64];
+			std::string longNumber;
+			const char* terminated{ buffer };
+			if (length < sizeof(buffer))
+			{
+				std::memcpy(buffer, first, length);
+				buffer[length] = '\0';
+			}
+			else
+			{
+				longNumber.assign(first, length);
+				terminated = longNumber.c_str();
+			}
+
+			char* numberEnd{ nullptr };
+			errno = 0;
+			const T value{ parseFloat<T>(terminated, &numberEnd) };
+			if (numberEnd == terminated) {
+				return false;
+			}
+			if (errno == ERANGE && (value > std::numeric_limits<T>::max() || value < std::numeric_limits<T>::lowest()))
+			{
+				t_value = value > 0 ? std::numeric_limits<T>::max() : std::numeric_limits<T>::lowest();
+				return false;
+			}
+			t_value = value;
+			return true;
+		}
+
+		template <typename T>
+		static bool parseNumber(const char* t_first, const char* t_last, T& t_value, std::integral_constant<NumberKindId, NumberKindId::character>)
+		{
+			const char* const first{ skipWhitespace(t_first, t_last) };
+			if (first == t_last) {
+				t_value = 0;
+				return false;
+			}
+			t_value = static_cast<T>(*first);
+			return true;
+		}
+
+		static bool parseNumber(const char* t_first, const char* t_last, bool& t_value, std::integral_constant<NumberKindId, NumberKindId::boolean>)
+		{
+			long long int number;
+			const bool isParsed{ parseNumber(t_first, t_last, number, std::integral_constant<NumberKindId, NumberKindId::integer>()) };
+			t_value = (number != 0);
+			return isParsed;
+		}
+
+		template <typename T>
+		static T parseFloat(const char* t_string, char** t_end);
+
+		/**
+		*	@brief  Writes digits from the end of a small buffer backwards, then moves them to t_first.
+		*/
+		template <typename T>
+		static char* formatNumber(char* t_first, const T t_value, std::integral_constant<NumberKindId, NumberKindId::integer>)
+		{
+			using Unsigned = typename std::make_unsigned<T>::type;
+			Unsigned magnitude{ static_cast<Unsigned>(t_value) };
+			if (t_value < 0)
+			{
+				*t_first++ = '-';
+				magnitude = static_cast<Unsigned>(0 - magnitude);
+			}
+
+			char digits[24];
+			char* digit{ digits + sizeof(digits) };
+			do
+			{
+				*--digit = static_cast<char>('0' + magnitude % 10);
+				magnitude = static_cast<Unsigned>(magnitude / 10);
+			} while (magnitude != 0);
+
+			const std::size_t length{ static_cast<std::size_t>(digits + sizeof(digits) - digit) };
+			std::memcpy(t_first, digit, length);
+			return t_first + length;
+		}
+
+		/**
+		*	@brief  Writes the fewest digits that read back to the same value (see FloatFormat.h).
+		*/
+		template <typename T>
+		static char* formatNumber(char* t_first, const T t_value, std::integral_constant<NumberKindId, NumberKindId::floatingPoint>)
+		{
+			if (std::isnan(t_value))
+			{
+				std::memcpy(t_first, "nan", 3);
+				return t_first + 3;
+			}
+			if (std::isinf(t_value))
+			{
+				if (t_value < 0)
+					*t_first++ = '-';
+				std::memcpy(t_first, "inf", 3);
+				return t_first + 3;
+			}
+
+			// Whole numbers small enough that every digit is exact are written as integers
+			const T wholeLimit{ std::min(static_cast<T>(1e18), std::numeric_limits<T>::radix / std::numeric_limits<T>::epsilon()) };
+			if (std::fabs(t_value) < wholeLimit && t_value == std::floor(t_value)) {
+				return formatNumber(t_first, static_cast<long long int>(t_value), std::integral_constant<NumberKindId, NumberKindId::integer>());
+			}
+
+			return formatFloat(t_first, t_value);
+		}
+
+		template <typename T>
+		static char* formatNumber(char* t_first, const T t_value, std::integral_constant<NumberKindId, NumberKindId::character>)
+		{
+			*t_first = static_cast<char>(t_value);
+			return t_first + 1;
+		}
+
+		static char* formatNumber(char* t_first, const bool t_value, std::integral_constant<NumberKindId, NumberKindId::boolean>)
+		{
+			*t_first = t_value ? '1' : '0';
+			return t_first + 1;
+		}
+
+		static char* formatFloat(char* t_first, const float t_value)
+		{
+			return FloatFormat::formatShortest(t_first, t_value);
+		}
+
+		static char* formatFloat(char* t_first, const double t_value)
+		{
+			return FloatFormat::formatShortest(t_first, t_value);
+		}
+
+		/**
+		*	@brief  long doubles are written with digits10 significant digits, or max_digits10 if that does not read back to the same value.
+		*/
+		static char* formatFloat(char* t_first, const long double t_value)
+		{
+			int length{ std::snprintf(t_first, maxNumberLength, "%.*Lg", std::numeric_limits<long double>::digits10, t_value) };
+			if (std::strtold(t_first, nullptr) != t_value) {
+				length = std::snprintf(t_first, maxNumberLength, "%.*Lg", std::numeric_limits<long double>::max_digits10, t_value);
+			}
+			return t_first + length;
+		}
+	};
+
+	template <>
+	inline float Import::parseFloat<float>(const char* t_string, char** t_end)
+	{
+		return std::strtof(t_string, t_end);
+	}
+
+	template <>
+	inline double Import::parseFloat<double>(const char* t_string, char** t_end)
+	{
+		return std::strtod(t_string, t_end);
+	}
+
+	template <>
+	inline long double Import::parseFloat<long double>(const char* t_string, char** t_end)
+	{
+		return std::strtold(t_string, t_end);
+	}
+
+	// Reads the tokens of one delimited line in order, without copying them
+	// Each token is consumed once, so reading n values is O(n)
+	class CSVCursor
+	{
+	public:
+		CSVCursor(const char* t_first, const char* t_last, const char t_delimiter = ',')
+			: m_position(t_first), m_last(t_last), m_delimiter(t_delimiter)
+		{
+			// Ignore the end of a line with Windows line endings
+			if (m_last != m_position && *(m_last - 1) == '\r')
+				--m_last;
+		};
+		explicit CSVCursor(const std::string& t_line, const char t_delimiter = ',')
+			: CSVCursor(t_line.data(), t_line.data() + t_line.length(), t_delimiter)
+		{ };
+
+		/**
+		*	@brief  Returns true once every token has been read
+		*
+		*	@return m_isDone
+		*/
+		bool isDone() const
+		{
+			return m_isDone;
+		}
+
+		/**
+		*	@brief  Reads the next token. A line always has at least one (possibly empty) token.
+		*
+		*	@param  t_token is set to the next token
+		*	@return true if a token was read, false if there were none left
+		*/
+		bool next(TokenView& t_token)
+		{
+			if (m_isDone) {
+				t_token = TokenView();
+				return false;
+			}
+			const std::size_t remaining{ static_cast<std::size_t>(m_last - m_position) };
+			const char* tokenEnd{ remaining > 0 ? static_cast<const char*>(std::memchr(m_position, m_delimiter, remaining)) : nullptr };
+			if (tokenEnd == nullptr)
+			{
+				tokenEnd = m_last;
+				m_isDone = true;
+			}
+			t_token = TokenView(m_position, static_cast<std::size_t>(tokenEnd - m_position));
+			m_position = m_isDone ? m_last : tokenEnd + 1;
+			return true;
+		}
+
+		/**
+		*	@brief  Reads the next token as a number (see Import::parseNumber())
+		*
+		*	@param  t_value is set to the number, or 0 if there was none
+		*	@return true if a number was read, false otherwise
+		*/
+		template <typename T>
+		bool read(T& t_value)
+		{
+			TokenView token;
+			if (!next(token)) {
+				t_value = 0;
+				return false;
+			}
+			return Import::parseNumber(token, t_value);
+		}
+
+		/**
+		*	@brief  Reads the next token as a bool written by Import::writeBoolVectorToCSVStream() ("T" or "F")
+		*
+		*	@param  t_value is set to true if the token is "T"
+		*	@return true if a token was read, false otherwise
+		*/
+		bool readBool(bool& t_value)
+		{
+			TokenView token;
+			const bool isRead{ next(token) };
+			t_value = (token == "T");
+			return isRead;
+		}
+
+		/**
+		*	@brief  Reads the next tokens as numbers into a vector, resizing it to t_count
+		*
+		*	@param  t_vec is filled with the numbers
+		*	@param  t_count specifies the number of tokens to read
+		*	@return true if every number was read, false otherwise
+		*/
+		template <typename T>
+		bool readVector(std::vector<T>& t_vec, const std::size_t t_count)
+		{
+			t_vec.resize(t_count);
+			bool isRead{ true };
+			for (std::size_t i{ 0 }; i < t_count; ++i) {
+				isRead &= read(t_vec[i]);
+			}
+			return isRead;
+		}
+
+		/**
+		*	@brief  Reads the next tokens as bools ("T" or "F") into a vector, resizing it to t_count
+		*
+		*	@param  t_vec is filled with the bools
+		*	@param  t_count specifies the number of tokens to read
+		*	@return true if every token was read, false otherwise
+		*/
+		bool readBoolVector(std::vector<bool>& t_vec, const std::size_t t_count)
+		{
+			t_vec.resize(t_count);
+			bool isRead{ true };
+			for (std::size_t i{ 0 }; i < t_count; ++i)
+			{
+				bool value;
+				isRead &= readBool(value);
+				t_vec[i] = value;
+			}
+			return isRead;
+		}
+
+		/**
+		*	@brief  Skips tokens without reading them
+		*
+		*	@param  t_count specifies the number of tokens to skip
+		*	@return Number of tokens skipped
+		*/
+		std::size_t skip(const std::size_t t_count)
+		{
+			TokenView token;
+			std::size_t skipped{ 0 };
+			while (skipped < t_count && next(token))
+				++skipped;
+			return skipped;
+		}
+
+	private:
+		const char* m_position;
+		const char* m_last;
+		char m_delimiter;
+		bool m_isDone{ false };
+	};
+
+	// Builds delimited lines in one block of memory, the reverse of CSVCursor
+	// The memory is kept by clear(), so a buffer can be reused for every line
+	class CSVBuffer
+	{
+	public:
+		explicit CSVBuffer(const char t_delimiter = ',')
+			: m_delimiter(t_delimiter)
+		{ };
+
+		const char* data() const { return m_data.data(); }
+		std::size_t size() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+		char getDelimiter() const { return m_delimiter; }
+
+		/**
+		*	@brief  Empties the buffer, keeping its memory
+		*
+		*	@return void
+		*/
+		void clear()
+		{
+			m_size = 0;
+			m_isLineStart = true;
+		}
+
+		/**
+		*	@brief  Makes room for at least t_size characters in total
+		*
+		*	@param  t_size specifies the number of characters
+		*	@return void
+		*/
+		void reserve(const std::size_t t_size)
+		{
+			if (t_size > m_data.size()) {
+				m_data.resize(std::max(t_size, m_data.size() * 2));
+			}
+		}
+
+		/**
+		*	@brief  Writes a number as the next value on the line (see Import::formatNumber())
+		*
+		*	@param  t_value specifies the number
+		*	@return void
+		*/
+		template <typename T>
+		void write(const T t_value)
+		{
+			char* position{ startValue(Import::maxNumberLength) };
+			m_size = static_cast<std::size_t>(Import::formatNumber(position, t_value) - m_data.data());
+		}
+
+		/**
+		*	@brief  Writes a bool as the next value on the line, as "T" or "F" (see CSVCursor::readBool())
+		*
+		*	@param  t_value specifies the bool
+		*	@return void
+		*/
+		void writeBool(const bool t_value)
+		{
+			char* position{ startValue(1) };
+			*position = t_value ? 'T' : 'F';
+			++m_size;
+		}
+
+		/**
+		*	@brief  Writes text as the next value on the line. The text is not quoted.
+		*
+		*	@param  t_text specifies the text
+		*	@param  t_length specifies the number of characters
+		*	@return void
+		*/
+		void writeText(const char* t_text, const std::size_t t_length)
+		{
+			char* position{ startValue(t_length) };
+			std::memcpy(position, t_text, t_length);
+			m_size += t_length;
+		}
+		void writeText(const std::string& t_text)
+		{
+			writeText(t_text.data(), t_text.length());
+		}
+
+		/**
+		*	@brief  Writes each number in a vector as the next values on the line
+		*
+		*	@param  t_vec specifies the numbers
+		*	@return void
+		*/
+		template <typename T>
+		void writeVector(const std::vector<T>& t_vec)
+		{
+			reserve(m_size + t_vec.size() * (Import::maxNumberLength + 1));
+			for (std::size_t i{ 0 }; i < t_vec.size(); ++i) {
+				write(static_cast<T>(t_vec[i]));
+			}
+		}
+
+		/**
+		*	@brief  Writes each bool in a vector as the next values on the line ("T" or "F")
+		*
+		*	@param  t_vec specifies the bools
+		*	@return void
+		*/
+		void writeBoolVector(const std::vector<bool>& t_vec)
+		{
+			reserve(m_size + t_vec.size() * 2 + 1);
+			for (std::size_t i{ 0 }; i < t_vec.size(); ++i) {
+				writeBool(t_vec[i]);
+			}
+		}
+
+		/**
+		*	@brief  Adds characters as they are, with no delimiter
+		*	Use this for text that already holds delimited values.
+		*
+		*	@param  t_text specifies the characters
+		*	@param  t_length specifies the number of characters
+		*	@return void
+		*/
+		void append(const char* t_text, const std::size_t t_length)
+		{
+			reserve(m_size + t_length + 1);
+			std::memcpy(&m_data[m_size], t_text, t_length);
+			m_size += t_length;
+			m_isLineStart = false;
+		}
+
+		/**
+		*	@brief  Continues a line that was started elsewhere, so the next value has a delimiter before it.
+		*	Use this when the buffer is added after values that are already written,
+		*	such as a file stream that is past the ID and score.
+		*
+		*	@return void
+		*/
+		void continueLine()
+		{
+			m_isLineStart = false;
+		}
+
+		/**
+		*	@brief  Ends the line. The next value starts a new line, with no delimiter before it.
+		*
+		*	@return void
+		*/
+		void endLine()
+		{
+			reserve(m_size + 1);
+			m_data[m_size++] = '\n';
+			m_isLineStart = true;
+		}
+
+	private:
+		/**
+		*	@brief  Makes room for a value, and writes the delimiter unless the value starts the line
+		*
+		*	@param  t_length specifies the most characters the value needs
+		*	@return Pointer to where the value is written
+		*/
+		char* startValue(const std::size_t t_length)
+		{
+			reserve(m_size + t_length + 1);
+			if (!m_isLineStart) {
+				m_data[m_size++] = m_delimiter;
+			}
+			m_isLineStart = false;
+			return &m_data[m_size];
+		}
+
+		// Only the first m_size characters are in use
+		std::vector<char> m_data;
+		std::size_t m_size{ 0 };
+		char m_delimiter;
+		bool m_isLineStart{ true };
 	};
 }
 
@@ -0,0 +1,321 @@
+/**
+* @class IslandModel.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a templated class for running several GeneticAlgorithms ("islands") in parallel with migration
+*
+* Each island is a complete GeneticAlgorithm with its own population, evolving on its own thread.
+* Every few generations, each island sends copies of its best Chromos to other islands,
+* which replace some of their Volatile Chromos. This keeps islands diverse while still
+* sharing good solutions.
+*
+* Migrants are passed through mailboxes that use atomic pointer swaps rather than locks,
+* so islands never wait on each other. Since islands run at their own pace, runs are not
+* repeatable when migration is enabled.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef ISLAND_MODEL_H_
+#define ISLAND_MODEL_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <string>
+#include <atomic>
+#include <memory>
+#include <iostream>
+
+#include "GeneticAlgorithm.h"
+#include "RandomGenerator.h"
+#include "ThreadPool.h"
+
+namespace ga
+{
+	// Which islands receive migrants from each island
+	enum class MigrationTopology { ring, fullyConnected, random };
+
+	template <typename C>
+	class IslandModel
+	{
+	public:
+		explicit IslandModel(const std::string t_name, const std::size_t t_islandCount, const std::size_t t_generationSize, const int t_initialStateId, const RandomGenerator t_randomGenerator)
+			: m_name(t_name),
+			m_randomGenerator(t_randomGenerator),
+			m_mailboxes(t_islandCount * t_islandCount),
+			m_threadPool(t_islandCount)
+		{
+			for (std::size_t i{ 0 }; i < t_islandCount; ++i) {
+				m_islands.push_back(new GeneticAlgorithm<C>(t_name + "_" + std::to_string(i), t_generationSize, t_initialStateId, m_randomGenerator.split()));
+				m_islandRandomGenerators.push_back(m_randomGenerator.split());
+			}
+			for (auto& mailbox : m_mailboxes) {
+				mailbox.store(nullptr);
+			}
+		};
+
+		~IslandModel()
+		{
+			// Cleanup
+			for (auto p : m_islands)
+				delete p;
+			for (auto& mailbox : m_mailboxes)
+				delete mailbox.exchange(nullptr);
+		};
+
+		IslandModel(const IslandModel&) = delete;
+		IslandModel& operator=(const IslandModel&) = delete;
+
+		// Runs every island for a number of generations, migrating along the way
+		void advanceGenerations(const unsigned long int);
+
+		// Each island can be configured like a normal GA
+		GeneticAlgorithm<C>& getIsland(const std::size_t);
+		std::size_t getIslandCount() const;
+
+		// Migration settings
+		void setMigrationInterval(const unsigned long int);
+		void setMigrationCount(const std::size_t);
+		void setMigrationTopology(const MigrationTopology);
+
+		// Print to console
+		friend std::ostream &operator<<(std::ostream& output, const IslandModel& self) {
+			output << "Island model " << self.m_name << "\n";
+			for (auto p : self.m_islands) {
+				output << *p;
+			}
+			return output;
+		}
+
+	private:
+		// A group of encoded Chromos sent from one island to another
+		typedef std::vector<std::string> MigrantBatch;
+
+		void runIsland(const std::size_t, const unsigned long int);
+		void sendMigrants(const std::size_t);
+		void receiveMigrants(const std::size_t);
+		void postBatch(const std::size_t, const std::size_t, const std::vector<std::string>&);
+		std::atomic<MigrantBatch*>& getMailbox(const std::size_t, const std::size_t);
+
+		std::string m_name;
+		std::vector<GeneticAlgorithm<C>*> m_islands;
+
+		// Migrate every m_migrationInterval generations
+		unsigned long int m_migrationInterval{ 10 };
+		// Number of Chromos sent each time
+		std::size_t m_migrationCount{ 2 };
+		MigrationTopology m_migrationTopology{ MigrationTopology::ring };
+
+		RandomGenerator m_randomGenerator;
+		// One stream per island, used to pick destinations for random migration
+		std::vector<RandomGenerator> m_islandRandomGenerators;
+
+		// One mailbox per (destination, source) pair, so every mailbox
+		// has a single writer and a single reader.
+		// A newer batch replaces one that has not been read yet.
+		std::vector<std::atomic<MigrantBatch*>> m_mailboxes;
+
+		// One thread per island
+		ThreadPool m_threadPool;
+	};
+
+	/**
+	*	@brief  Runs every island on its own thread for a number of generations.
+	*	Islands send migrants every m_migrationInterval generations
+	*	(counted by each island's own generation number), and pick up
+	*	any migrants waiting for them at the same time.
+	*
+	*	@param  t_generations specifies the number of generations to run on each island
+	*	@return void
+	*/
+	template <typename C>
+	void IslandModel<C>::advanceGenerations(const unsigned long int t_generations)
+	{
+		auto runIslands = [this, t_generations](const std::size_t t_first, const std::size_t t_last)
+		{
+			for (std::size_t i{ t_first }; i < t_last; ++i) {
+				runIsland(i, t_generations);
+			}
+		};
+		m_threadPool.parallelFor(m_islands.size(), 1, runIslands);
+	}
+
+	/**
+	*	@brief  Returns an island, so that its GA settings can be changed.
+	*
+	*	@param  t_islandId specifies the island
+	*	@return Reference to the island's GA
+	*/
+	template <typename C>
+	GeneticAlgorithm<C>& IslandModel<C>::getIsland(const std::size_t t_islandId)
+	{
+		return *m_islands.at(t_islandId);
+	}
+
+	/**
+	*	@brief  Returns the number of islands.
+	*
+	*	@return Island count
+	*/
+	template <typename C>
+	std::size_t IslandModel<C>::getIslandCount() const
+	{
+		return m_islands.size();
+	}
+
+	/**
+	*	@brief  Sets m_migrationInterval, the number of generations between migrations.
+	*
+	*	@param  t_migrationInterval must be at least 1.
+	*	@return void
+	*/
+	template <typename C>
+	void IslandModel<C>::setMigrationInterval(const unsigned long int t_migrationInterval)
+	{
+		if (t_migrationInterval >= 1) {
+			m_migrationInterval = t_migrationInterval;
+		}
+		else {
+			m_migrationInterval = 1;
+			std::cout << "\nERROR: Migration interval must be at least 1. Setting to 1.\n\n";
+		}
+	}
+
+	/**
+	*	@brief  Sets m_migrationCount, the number of Chromos each island sends per migration.
+	*	Use 0 to disable migration.
+	*
+	*	@param  t_migrationCount is the new migration count
+	*	@return void
+	*/
+	template <typename C>
+	void IslandModel<C>::setMigrationCount(const std::size_t t_migrationCount)
+	{
+		m_migrationCount = t_migrationCount;
+	}
+
+	/**
+	*	@brief  Sets m_migrationTopology, which controls the islands that receive migrants.
+	*		ring - island i sends to island (i + 1)
+	*		fullyConnected - every island sends to every other island
+	*		random - each migration, a random other island is chosen
+	*
+	*	@param  t_migrationTopology is the new topology
+	*	@return void
+	*/
+	template <typename C>
+	void IslandModel<C>::setMigrationTopology(const MigrationTopology t_migrationTopology)
+	{
+		m_migrationTopology = t_migrationTopology;
+	}
+
+	/**
+	*	@brief  Evolves one island. Called on the island's own thread.
+	*
+	*	@param  t_islandId specifies the island
+	*	@param  t_generations specifies the number of generations to run
+	*	@return void
+	*/
+	template <typename C>
+	void IslandModel<C>::runIsland(const std::size_t t_islandId, const unsigned long int t_generations)
+	{
+		GeneticAlgorithm<C>* island{ m_islands.at(t_islandId) };
+		for (unsigned long int g{ 0 }; g < t_generations; ++g)
+		{
+			island->advanceGeneration();
+
+			if (m_migrationCount > 0 && m_islands.size() > 1 && island->getGeneration() % m_migrationInterval == 0) {
+				sendMigrants(t_islandId);
+				receiveMigrants(t_islandId);
+			}
+		}
+	}
+
+	/**
+	*	@brief  Posts copies of an island's best Chromos to its destination islands.
+	*
+	*	@param  t_islandId specifies the sending island
+	*	@return void
+	*/
+	template <typename C>
+	void IslandModel<C>::sendMigrants(const std::size_t t_islandId)
+	{
+		std::vector<std::string> migrants;
+		m_islands.at(t_islandId)->getTopEncodings(migrants, m_migrationCount);
+		if (migrants.empty()) {
+			return;
+		}
+
+		const std::size_t islandCount{ m_islands.size() };
+		if (m_migrationTopology == MigrationTopology::ring) {
+			postBatch((t_islandId + 1) % islandCount, t_islandId, migrants);
+		}
+		else if (m_migrationTopology == MigrationTopology::fullyConnected) {
+			for (std::size_t destination{ 0 }; destination < islandCount; ++destination) {
+				if (destination != t_islandId) {
+					postBatch(destination, t_islandId, migrants);
+				}
+			}
+		}
+		else if (m_migrationTopology == MigrationTopology::random) {
+			// Any island except this one, with equal probability
+			std::size_t destination{ m_islandRandomGenerators.at(t_islandId).nextIndex(islandCount - 1) };
+			if (destination >= t_islandId) {
+				++destination;
+			}
+			postBatch(destination, t_islandId, migrants);
+		}
+	}
+
+	/**
+	*	@brief  Imports every batch of migrants waiting for an island.
+	*
+	*	@param  t_islandId specifies the receiving island
+	*	@return void
+	*/
+	template <typename C>
+	void IslandModel<C>::receiveMigrants(const std::size_t t_islandId)
+	{
+		for (std::size_t source{ 0 }; source < m_islands.size(); ++source)
+		{
+			std::unique_ptr<MigrantBatch> batch(getMailbox(t_islandId, source).exchange(nullptr, std::memory_order_acq_rel));
+			if (batch) {
+				m_islands.at(t_islandId)->importMigrants(*batch);
+			}
+		}
+	}
+
+	/**
+	*	@brief  Places a batch in a mailbox, discarding any older batch that was never picked up.
+	*
+	*	@param  t_destination specifies the receiving island
+	*	@param  t_source specifies the sending island
+	*	@param  t_migrants specifies the encoded Chromos to send
+	*	@return void
+	*/
+	template <typename C>
+	void IslandModel<C>::postBatch(const std::size_t t_destination, const std::size_t t_source, const std::vector<std::string>& t_migrants)
+	{
+		MigrantBatch* batch{ new MigrantBatch(t_migrants) };
+		delete getMailbox(t_destination, t_source).exchange(batch, std::memory_order_acq_rel);
+	}
+
+	/**
+	*	@brief  Returns the mailbox used by one island to send to another.
+	*
+	*	@param  t_destination specifies the receiving island
+	*	@param  t_source specifies the sending island
+	*	@return Reference to the mailbox
+	*/
+	template <typename C>
+	std::atomic<typename IslandModel<C>::MigrantBatch*>& IslandModel<C>::getMailbox(const std::size_t t_destination, const std::size_t t_source)
+	{
+		return m_mailboxes.at(t_destination * m_islands.size() + t_source);
+	}
+
+} // namespace ga
+
+#endif	// ISLAND_MODEL_H_
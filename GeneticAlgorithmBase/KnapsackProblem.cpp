@@ -0,0 +1,343 @@
+#include "KnapsackProblem.h"
+
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+
+#include "CSVTable.h"
+#include "MaskedSumKernels.h"
+
+namespace ga
+{
+	/**
+	*	@brief  Loads the items from a CSV file, one item per row.
+	*	The first line must hold the column names. Any problem already loaded is replaced.
+	*
+	*	@param  t_filename specifies the path and filename of the file
+	*	@param  t_valueColumn specifies the column holding each item's value
+	*	@param  t_weightColumns specifies the column holding each item's weight, for each dimension
+	*	@param  t_capacities specifies the capacity of the bag, for each dimension
+	*	@param  t_threadPool specifies the threads used to parse the file, or nullptr to use the calling thread
+	*	@param  t_delimiter specifies the character between values
+	*	@return true if every item was loaded, false otherwise
+	*/
+	bool KnapsackProblem::loadFromCSV(const std::string t_filename, const std::string t_valueColumn, const std::vector<std::string> t_weightColumns,
+		const std::vector<std::int64_t> t_capacities, ThreadPool* t_threadPool, const char t_delimiter)
+	{
+		clear();
+		CSVTable table;
+		if (!table.open(t_filename, true, t_threadPool, t_delimiter)) {
+			return false;
+		}
+
+		bool isLoaded{ table.loadColumn(t_valueColumn, CSVColumnType::int32, t_threadPool) };
+		for (std::size_t i{ 0 }; i < t_weightColumns.size() && isLoaded; ++i) {
+			isLoaded = table.loadColumn(t_weightColumns[i], CSVColumnType::int32, t_threadPool);
+		}
+		if (!isLoaded) {
+			std::cout << "\nERROR: Unable to read the knapsack items in " + t_filename + "\n\n";
+			return false;
+		}
+
+		std::vector<const std::int32_t*> weights;
+		for (std::size_t i{ 0 }; i < t_weightColumns.size(); ++i) {
+			weights.push_back(table.getColumn<std::int32_t>(t_weightColumns[i]));
+		}
+		return setItems(table.getRowCount(), table.getColumn<std::int32_t>(t_valueColumn), weights, t_capacities);
+	}
+
+	/**
+	*	@brief  Copies the items from arrays. Any problem already loaded is replaced.
+	*	Values, weights and capacities may not be negative.
+	*
+	*	@param  t_itemCount specifies the number of items
+	*	@param  t_values points to each item's value
+	*	@param  t_weights points to each item's weight, for each dimension
+	*	@param  t_capacities specifies the capacity of the bag, for each dimension
+	*	@return true if the items were set, false otherwise
+	*/
+	bool KnapsackProblem::setItems(const std::size_t t_itemCount, const std::int32_t* t_values, const std::vector<const std::int32_t*> t_weights,
+		const std::vector<std::int64_t> t_capacities)
+	{
+		clear();
+		if (t_itemCount == 0 || t_values == nullptr) {
+			std::cout << "\nERROR: A knapsack problem needs at least 1 item\n\n";
+			return false;
+		}
+		if (t_weights.empty() || t_weights.size() != t_capacities.size()) {
+			std::cout << "\nERROR: A knapsack problem needs a capacity for each weight dimension\n\n";
+			return false;
+		}
+		for (std::size_t dimension{ 0 }; dimension < t_weights.size(); ++dimension)
+		{
+			if (t_weights[dimension] == nullptr || t_capacities[dimension] < 0) {
+				std::cout << "\nERROR: Knapsack dimension " << dimension << " has no weights or a negative capacity\n\n";
+				return false;
+			}
+		}
+		for (std::size_t i{ 0 }; i < t_itemCount; ++i)
+		{
+			bool isNegative{ t_values[i] < 0 };
+			for (std::size_t dimension{ 0 }; dimension < t_weights.size(); ++dimension) {
+				isNegative |= (t_weights[dimension][i] < 0);
+			}
+			if (isNegative) {
+				std::cout << "\nERROR: Knapsack item " << i << " has a negative value or weight\n\n";
+				return false;
+			}
+		}
+
+		m_itemCount = t_itemCount;
+		m_paddedItemCount = (t_itemCount + itemPadding - 1) / itemPadding * itemPadding;
+		m_values = createItemArray(t_values);
+		for (std::size_t dimension{ 0 }; dimension < t_weights.size(); ++dimension) {
+			m_weights.push_back(createItemArray(t_weights[dimension]));
+		}
+		m_capacities = t_capacities;
+		return true;
+	}
+
+	void KnapsackProblem::clear()
+	{
+		m_itemCount = 0;
+		m_paddedItemCount = 0;
+		m_values.reset();
+		m_weights.clear();
+		m_capacities.clear();
+	}
+
+	std::size_t KnapsackProblem::getItemCount() const
+	{
+		return m_itemCount;
+	}
+
+	std::size_t KnapsackProblem::getDimensionCount() const
+	{
+		return m_weights.size();
+	}
+
+	/**
+	*	@brief  Returns the size of a selection, with one bit per item.
+	*
+	*	@return number of bytes
+	*/
+	std::size_t KnapsackProblem::getSelectionBytes() const
+	{
+		return (m_itemCount + 7) / 8;
+	}
+
+	/**
+	*	@brief  Returns the value of each item, padded with zeros to a multiple of itemPadding.
+	*
+	*	@return Pointer to the values, or nullptr if no items are loaded
+	*/
+	const std::int32_t* KnapsackProblem::getValues() const
+	{
+		return m_values ? m_values->data : nullptr;
+	}
+
+	/**
+	*	@brief  Returns the weight of each item in one dimension, padded with zeros to a multiple of itemPadding.
+	*
+	*	@param  t_dimension specifies the dimension
+	*	@return Pointer to the weights, or nullptr if there is no such dimension
+	*/
+	const std::int32_t* KnapsackProblem::getWeights(const std::size_t t_dimension) const
+	{
+		return t_dimension < m_weights.size() ? m_weights[t_dimension]->data : nullptr;
+	}
+
+	std::int64_t KnapsackProblem::getCapacity(const std::size_t t_dimension) const
+	{
+		return t_dimension < m_capacities.size() ? m_capacities[t_dimension] : 0;
+	}
+
+	/**
+	*	@brief  Returns the total value of a selection of items.
+	*
+	*	@param  t_selection specifies the bitset of items in the bag
+	*	@return total value
+	*/
+	std::int64_t KnapsackProblem::sumValues(const unsigned char* t_selection) const
+	{
+		return m_values ? maskedSum(m_values->data, t_selection, getSelectionBytes()) : 0;
+	}
+
+	/**
+	*	@brief  Returns the total weight of a selection of items in one dimension.
+	*
+	*	@param  t_dimension specifies the dimension
+	*	@param  t_selection specifies the bitset of items in the bag
+	*	@return total weight
+	*/
+	std::int64_t KnapsackProblem::sumWeights(const std::size_t t_dimension, const unsigned char* t_selection) const
+	{
+		return t_dimension < m_weights.size() ? maskedSum(m_weights[t_dimension]->data, t_selection, getSelectionBytes()) : 0;
+	}
+
+	/**
+	*	@brief  Returns true if a selection of items is within the capacity of every dimension.
+	*
+	*	@param  t_selection specifies the bitset of items in the bag
+	*	@return true if the items fit in the bag
+	*/
+	bool KnapsackProblem::isFeasible(const unsigned char* t_selection) const
+	{
+		for (std::size_t dimension{ 0 }; dimension < m_weights.size(); ++dimension) {
+			if (sumWeights(dimension, t_selection) > m_capacities[dimension]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	*	@brief  Scores a selection of items (see scoreTotals()).
+	*
+	*	@param  t_selection specifies the bitset of items in the bag
+	*	@return score, always above 0
+	*/
+	double KnapsackProblem::scoreSelection(const unsigned char* t_selection) const
+	{
+		std::int64_t* totals{ getTotalsBuffer() };
+		sumTotals(t_selection, totals);
+		return scoreTotals(totals);
+	}
+
+	/**
+	*	@brief  Adds up the value and weights of a selection of items.
+	*
+	*	@param  t_selection specifies the bitset of items in the bag
+	*	@param  t_totals is set to the value, then the weight in each dimension
+	*	@return void
+	*/
+	void KnapsackProblem::sumTotals(const unsigned char* t_selection, std::int64_t* t_totals) const
+	{
+		t_totals[0] = sumValues(t_selection);
+		for (std::size_t dimension{ 0 }; dimension < m_weights.size(); ++dimension) {
+			t_totals[1 + dimension] = sumWeights(dimension, t_selection);
+		}
+	}
+
+	/**
+	*	@brief  Updates the totals of a selection after some items were added or taken out.
+	*	Only the 64-bit words of the bitset that differ are summed, so a few
+	*	changes cost little more than comparing the two bitsets.
+	*
+	*	@param  t_previousSelection specifies the bitset the totals are for
+	*	@param  t_selection specifies the new bitset
+	*	@param  t_totals holds the totals of t_previousSelection, and is set to those of t_selection
+	*	@return void
+	*/
+	void KnapsackProblem::updateTotals(const unsigned char* t_previousSelection, const unsigned char* t_selection, std::int64_t* t_totals) const
+	{
+		updateTotals(t_previousSelection, t_selection, t_totals, 0, getSelectionBytes());
+	}
+
+	/**
+	*	@brief  Updates the totals of a selection where only a range of its bytes may have changed.
+	*	The range is widened to whole 64-bit words, and only those words are
+	*	read, so the cost depends on the range rather than the item count.
+	*	Both bitsets must hold valid bytes across those words (up to getSelectionBytes()).
+	*
+	*	@param  t_previousSelection specifies the bitset the totals are for
+	*	@param  t_selection specifies the new bitset
+	*	@param  t_totals holds the totals of t_previousSelection, and is set to those of t_selection
+	*	@param  t_firstByte specifies the first byte that may have changed
+	*	@param  t_endByte specifies the byte after the last one that may have changed
+	*	@return void
+	*/
+	void KnapsackProblem::updateTotals(const unsigned char* t_previousSelection, const unsigned char* t_selection, std::int64_t* t_totals,
+		const std::size_t t_firstByte, const std::size_t t_endByte) const
+	{
+		if (!m_values) {
+			return;
+		}
+		const std::size_t bytes{ getSelectionBytes() };
+		const std::size_t endByte{ std::min(t_endByte, bytes) };
+		for (std::size_t byte{ t_firstByte - t_firstByte % 8 }; byte < endByte; byte += 8)
+		{
+			const std::uint64_t previousWord{ loadBitsetWord(t_previousSelection, byte, bytes) };
+			const std::uint64_t word{ loadBitsetWord(t_selection, byte, bytes) };
+			if (previousWord == word) {
+				continue;
+			}
+			// Items added and items taken out, in the same bit order as the selection
+			unsigned char added[8];
+			unsigned char removed[8];
+			const std::uint64_t addedWord{ word & ~previousWord };
+			const std::uint64_t removedWord{ previousWord & ~word };
+			std::memcpy(added, &addedWord, 8);
+			std::memcpy(removed, &removedWord, 8);
+
+			const std::size_t firstItem{ byte * 8 };
+			t_totals[0] += maskedSum(m_values->data + firstItem, added, 8) - maskedSum(m_values->data + firstItem, removed, 8);
+			for (std::size_t dimension{ 0 }; dimension < m_weights.size(); ++dimension)
+			{
+				const std::int32_t* weights{ m_weights[dimension]->data + firstItem };
+				t_totals[1 + dimension] += maskedSum(weights, added, 8) - maskedSum(weights, removed, 8);
+			}
+		}
+	}
+
+	/**
+	*	@brief  Scores a selection from its totals.
+	*	A selection that fits scores its total value, plus 1. A selection that
+	*	does not fit scores 1 / (1 + excess), where excess is the weight over
+	*	each capacity as a fraction of that capacity, summed over every
+	*	dimension. So every score is valid, and every selection that fits
+	*	beats every selection that does not, while overweight selections
+	*	are still guided towards the capacity.
+	*
+	*	@param  t_totals specifies the value, then the weight in each dimension
+	*	@return score, always above 0
+	*/
+	double KnapsackProblem::scoreTotals(const std::int64_t* t_totals) const
+	{
+		double excess{ 0.0 };
+		for (std::size_t dimension{ 0 }; dimension < m_weights.size(); ++dimension)
+		{
+			const std::int64_t overweight{ t_totals[1 + dimension] - m_capacities[dimension] };
+			if (overweight > 0) {
+				excess += static_cast<double>(overweight) / static_cast<double>(std::max(m_capacities[dimension], static_cast<std::int64_t>(1)));
+			}
+		}
+		if (excess > 0.0) {
+			return 1.0 / (1.0 + excess);
+		}
+		return static_cast<double>(t_totals[0] + 1);
+	}
+
+	/**
+	*	@brief  Returns room for one set of totals, for scoring without allocating.
+	*	Each thread has its own buffer, which only allocates when it first
+	*	grows. It is reused by the next call on the same thread.
+	*
+	*	@return Pointer to 1 + getDimensionCount() totals
+	*/
+	std::int64_t* KnapsackProblem::getTotalsBuffer() const
+	{
+		static thread_local std::vector<std::int64_t> totals;
+		totals.resize(1 + m_weights.size());
+		return totals.data();
+	}
+
+	/**
+	*	@brief  Copies an item array into aligned memory, padded with zeros.
+	*
+	*	@param  t_items points to m_itemCount values
+	*	@return aligned copy
+	*/
+	std::unique_ptr<KnapsackProblem::ItemArray> KnapsackProblem::createItemArray(const std::int32_t* t_items) const
+	{
+		std::unique_ptr<ItemArray> items{ new ItemArray() };
+		items->rawData.reset(new char[m_paddedItemCount * sizeof(std::int32_t) + alignment]);
+		const std::size_t address{ reinterpret_cast<std::size_t>(items->rawData.get()) };
+		items->data = reinterpret_cast<std::int32_t*>(items->rawData.get() + (alignment - address % alignment) % alignment);
+
+		std::memcpy(items->data, t_items, m_itemCount * sizeof(std::int32_t));
+		std::fill(items->data + m_itemCount, items->data + m_paddedItemCount, 0);
+		return items;
+	}
+
+} // namespace ga
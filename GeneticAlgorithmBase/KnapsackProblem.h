@@ -0,0 +1,99 @@
+/**
+* @class KnapsackProblem.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains the items of a knapsack problem, stored for fast scoring of bitsets
+*
+* Each item has a value, and a weight in each dimension (such as mass and
+* volume). Each dimension has its own capacity. A selection of items is a
+* bitset, where bit i is set if item i is in the bag.
+*
+* Values and weights are kept as separate aligned arrays of 32-bit integers
+* (structure of arrays), padded with zeros to a multiple of 64 items, so a
+* selection is scored with one masked sum per array (see MaskedSumKernels.h).
+* Once loaded, a problem is only read, so one copy is shared by every
+* Chromo and thread:
+*
+*	auto problem = std::make_shared<ga::KnapsackProblem>();
+*	problem->loadFromCSV("items.csv", "value", { "mass", "volume" }, { 5000, 800 }, threadPool);
+*	ga::ChromoLargeKnapsack::setProblem(problem);
+*
+* @see (link to GitHub)
+*/
+
+#ifndef KNAPSACK_PROBLEM_H_
+#define KNAPSACK_PROBLEM_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+#include "ThreadPool.h"
+
+namespace ga
+{
+	class KnapsackProblem
+	{
+	public:
+		KnapsackProblem() {};
+		~KnapsackProblem() {};
+
+		KnapsackProblem(const KnapsackProblem&) = delete;
+		KnapsackProblem& operator=(const KnapsackProblem&) = delete;
+
+		// Alignment of every item array
+		static const std::size_t alignment{ 64 };
+		// Item arrays are padded with zeros to a multiple of this
+		static const std::size_t itemPadding{ 64 };
+
+		bool loadFromCSV(const std::string, const std::string, const std::vector<std::string>, const std::vector<std::int64_t>, ThreadPool* = nullptr, const char = ',');
+		bool setItems(const std::size_t, const std::int32_t*, const std::vector<const std::int32_t*>, const std::vector<std::int64_t>);
+		void clear();
+
+		std::size_t getItemCount() const;
+		std::size_t getDimensionCount() const;
+		std::size_t getSelectionBytes() const;
+		const std::int32_t* getValues() const;
+		const std::int32_t* getWeights(const std::size_t) const;
+		std::int64_t getCapacity(const std::size_t) const;
+
+		// Each takes a selection of getSelectionBytes() bytes
+		std::int64_t sumValues(const unsigned char*) const;
+		std::int64_t sumWeights(const std::size_t, const unsigned char*) const;
+		bool isFeasible(const unsigned char*) const;
+		double scoreSelection(const unsigned char*) const;
+
+		// Totals are the value, then the weight in each dimension (1 + getDimensionCount() in all)
+		void sumTotals(const unsigned char*, std::int64_t*) const;
+		void updateTotals(const unsigned char*, const unsigned char*, std::int64_t*) const;
+		void updateTotals(const unsigned char*, const unsigned char*, std::int64_t*, const std::size_t, const std::size_t) const;
+		double scoreTotals(const std::int64_t*) const;
+		std::int64_t* getTotalsBuffer() const;
+
+	private:
+		struct ItemArray
+		{
+			// Raw allocation, and the same memory rounded up to the alignment
+			std::unique_ptr<char[]> rawData;
+			std::int32_t* data{ nullptr };
+		};
+
+		std::unique_ptr<ItemArray> createItemArray(const std::int32_t*) const;
+
+		std::size_t m_itemCount{ 0 };
+		std::size_t m_paddedItemCount{ 0 };
+		std::unique_ptr<ItemArray> m_values;
+		// One array per dimension
+		std::vector<std::unique_ptr<ItemArray>> m_weights;
+		std::vector<std::int64_t> m_capacities;
+	};
+
+} // namespace ga
+
+#endif	// KNAPSACK_PROBLEM_H_
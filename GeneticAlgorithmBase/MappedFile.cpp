@@ -0,0 +1,151 @@
+#include "MappedFile.h"
+
+#include <iostream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif	// NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif	// _WIN32
+
+namespace ga
+{
+	/**
+	*	@brief  Maps a whole file into memory, read-only. Any file already open is closed first.
+	*	An empty file opens successfully, with no data.
+	*
+	*	@param  t_filename specifies the path and filename of the file
+	*	@return true if the file was mapped, false otherwise
+	*/
+	bool MappedFile::open(const std::string t_filename)
+	{
+		close();
+
+#ifdef _WIN32
+		HANDLE fileHandle{ CreateFileA(t_filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr) };
+		if (fileHandle == INVALID_HANDLE_VALUE) {
+			std::cout << "\nERROR: Unable to open file " + t_filename + "\n\n";
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize)) {
+			CloseHandle(fileHandle);
+			std::cout << "\nERROR: Unable to read the size of file " + t_filename + "\n\n";
+			return false;
+		}
+		m_fileHandle = fileHandle;
+		m_size = static_cast<std::size_t>(fileSize.QuadPart);
+
+		if (m_size > 0)
+		{
+			m_mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (m_mappingHandle != nullptr) {
+				m_data = static_cast<const char*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+			}
+			if (m_data == nullptr) {
+				close();
+				std::cout << "\nERROR: Unable to map file " + t_filename + " into memory\n\n";
+				return false;
+			}
+		}
+#else
+		const int fileDescriptor{ ::open(t_filename.c_str(), O_RDONLY) };
+		if (fileDescriptor < 0) {
+			std::cout << "\nERROR: Unable to open file " + t_filename + "\n\n";
+			return false;
+		}
+
+		struct stat fileStatus;
+		if (fstat(fileDescriptor, &fileStatus) != 0) {
+			::close(fileDescriptor);
+			std::cout << "\nERROR: Unable to read the size of file " + t_filename + "\n\n";
+			return false;
+		}
+		m_size = static_cast<std::size_t>(fileStatus.st_size);
+
+		if (m_size > 0)
+		{
+			void* mapping{ mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0) };
+			if (mapping == MAP_FAILED) {
+				::close(fileDescriptor);
+				m_size = 0;
+				std::cout << "\nERROR: Unable to map file " + t_filename + " into memory\n\n";
+				return false;
+			}
+			m_data = static_cast<const char*>(mapping);
+		}
+		// The mapping stays valid once the file is closed
+		::close(fileDescriptor);
+#endif	// _WIN32
+
+		m_isOpen = true;
+		return true;
+	}
+
+	/**
+	*	@brief  Unmaps the file. Pointers returned by data() are no longer valid.
+	*
+	*	@return void
+	*/
+	void MappedFile::close()
+	{
+#ifdef _WIN32
+		if (m_data != nullptr) {
+			UnmapViewOfFile(m_data);
+		}
+		if (m_mappingHandle != nullptr) {
+			CloseHandle(m_mappingHandle);
+		}
+		if (m_fileHandle != nullptr) {
+			CloseHandle(m_fileHandle);
+		}
+		m_mappingHandle = nullptr;
+		m_fileHandle = nullptr;
+#else
+		if (m_data != nullptr) {
+			munmap(const_cast<char*>(m_data), m_size);
+		}
+#endif	// _WIN32
+		m_data = nullptr;
+		m_size = 0;
+		m_isOpen = false;
+	}
+
+	/**
+	*	@brief  Returns true if a file is mapped.
+	*
+	*	@return m_isOpen
+	*/
+	bool MappedFile::isOpen() const
+	{
+		return m_isOpen;
+	}
+
+	/**
+	*	@brief  Returns the file's bytes. These must not be written to.
+	*
+	*	@return Pointer to the first byte, or nullptr if no file (or an empty file) is mapped
+	*/
+	const char* MappedFile::data() const
+	{
+		return m_data;
+	}
+
+	/**
+	*	@brief  Returns the size of the file.
+	*
+	*	@return Number of bytes
+	*/
+	std::size_t MappedFile::size() const
+	{
+		return m_size;
+	}
+
+} // namespace ga
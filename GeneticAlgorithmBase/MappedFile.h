@@ -0,0 +1,58 @@
+/**
+* @class MappedFile.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a read-only view of a whole file, mapped into memory
+*
+* The file's bytes are read straight from the operating system's page cache,
+* so opening even a very large file takes no time and allocates nothing.
+* Pages are only read from disk when they are first touched, and several
+* threads or processes mapping the same file share one copy.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef MAPPED_FILE_H_
+#define MAPPED_FILE_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <string>
+#include <cstddef>
+
+namespace ga
+{
+	class MappedFile
+	{
+	public:
+		MappedFile() {};
+		~MappedFile()
+		{
+			close();
+		};
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool open(const std::string);
+		void close();
+		bool isOpen() const;
+
+		const char* data() const;
+		std::size_t size() const;
+
+	private:
+		const char* m_data{ nullptr };
+		std::size_t m_size{ 0 };
+		bool m_isOpen{ false };
+#ifdef _WIN32
+		void* m_fileHandle{ nullptr };
+		void* m_mappingHandle{ nullptr };
+#endif	// _WIN32
+	};
+
+} // namespace ga
+
+#endif	// MAPPED_FILE_H_
@@ -0,0 +1,155 @@
+/**
+* @class MaskedSumKernels.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains vectorized kernels that sum the values chosen by a bitset, used by KnapsackProblem.h
+*
+* A masked sum adds value i whenever bit i of a bitset is set:
+*	sum = values[0] * bit0 + values[1] * bit1 + ...
+* The bitset is read 64 bits at a time, and words with no bits set are
+* skipped, so sparse selections are cheap.
+*
+* With AVX2, each byte of the bitset is spread across 8 lanes and used to
+* mask 8 values at once. Otherwise each value is masked without a branch,
+* which the compiler can vectorize. The instruction set is chosen with
+* getSimdLevel() (see CrossoverKernels.h).
+*
+* The values must be padded to a whole number of 64-bit words, so every
+* bit of the last word has a value to mask (padding values should be 0).
+*
+* @see (link to GitHub)
+*/
+
+#ifndef MASKED_SUM_KERNELS_H_
+#define MASKED_SUM_KERNELS_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <cstdint>
+#include <cstring>
+
+#include "CrossoverKernels.h"
+
+namespace ga
+{
+	/**
+	*	@brief  Reads the 64-bit word of a bitset that starts at a given byte.
+	*	Bytes past the end of the bitset are read as 0.
+	*
+	*	@param  t_bits specifies the bitset
+	*	@param  t_byte specifies the first byte of the word
+	*	@param  t_bytes specifies the number of bytes in the bitset
+	*	@return bits of the word, in little-endian order
+	*/
+	inline std::uint64_t loadBitsetWord(const unsigned char* t_bits, const std::size_t t_byte, const std::size_t t_bytes)
+	{
+		std::uint64_t word{ 0 };
+		std::memcpy(&word, t_bits + t_byte, t_bytes - t_byte < 8 ? t_bytes - t_byte : 8);
+		return word;
+	}
+
+	/**
+	*	@brief  Adds every value whose bit is set, 64 values at a time.
+	*	The inner loop has no branches, so the compiler can vectorize it.
+	*
+	*	@param  t_values specifies the values, padded to a multiple of 64
+	*	@param  t_bits specifies the bitset. Bit i chooses value i.
+	*	@param  t_bytes specifies the number of bytes in the bitset
+	*	@return sum of the chosen values
+	*/
+	inline std::int64_t maskedSumScalar(const std::int32_t* t_values, const unsigned char* t_bits, const std::size_t t_bytes)
+	{
+		std::int64_t sum{ 0 };
+		for (std::size_t byte{ 0 }; byte < t_bytes; byte += 8)
+		{
+			const std::uint64_t word{ loadBitsetWord(t_bits, byte, t_bytes) };
+			if (word == 0) {
+				continue;
+			}
+			const std::int32_t* values{ t_values + byte * 8 };
+			std::int64_t wordSum{ 0 };
+			for (std::size_t i{ 0 }; i < 64; ++i) {
+				// All bits set if chosen, otherwise 0
+				const std::int32_t mask{ -static_cast<std::int32_t>((word >> i) & 1) };
+				wordSum += values[i] & mask;
+			}
+			sum += wordSum;
+		}
+		return sum;
+	}
+
+#ifdef GA_SIMD_X86_
+	/**
+	*	@brief  Adds every value whose bit is set, 8 values at a time.
+	*	See maskedSumScalar(). Sums are kept as 64-bit integers, so they
+	*	cannot overflow. Only call this if the CPU supports AVX2.
+	*
+	*	@return sum of the chosen values
+	*/
+	GA_TARGET_AVX2_ inline std::int64_t maskedSumAvx2(const std::int32_t* t_values, const unsigned char* t_bits, const std::size_t t_bytes)
+	{
+		// Lane i is chosen by bit i of a byte
+		const __m256i laneBits{ _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128) };
+		__m256i sumLow{ _mm256_setzero_si256() };
+		__m256i sumHigh{ _mm256_setzero_si256() };
+
+		for (std::size_t byte{ 0 }; byte < t_bytes; byte += 8)
+		{
+			std::uint64_t word{ loadBitsetWord(t_bits, byte, t_bytes) };
+			const std::int32_t* values{ t_values + byte * 8 };
+			for (; word != 0; word >>= 8, values += 8)
+			{
+				const int bits{ static_cast<int>(word & 0xFF) };
+				if (bits == 0) {
+					continue;
+				}
+				const __m256i spread{ _mm256_and_si256(_mm256_set1_epi32(bits), laneBits) };
+				const __m256i mask{ _mm256_cmpeq_epi32(spread, laneBits) };
+				const __m256i taken{ _mm256_and_si256(mask, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values))) };
+				sumLow = _mm256_add_epi64(sumLow, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(taken)));
+				sumHigh = _mm256_add_epi64(sumHigh, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(taken, 1)));
+			}
+		}
+
+		std::int64_t lanes[4];
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(sumLow, sumHigh));
+		return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+	}
+#endif	// GA_SIMD_X86_
+
+	/**
+	*	@brief  Adds every value whose bit is set, using a chosen instruction set.
+	*	There is no SSE2 version, as SSE2 cannot widen 32-bit lanes in one
+	*	instruction, so SSE2 and levels not available on this platform use scalar code.
+	*
+	*	@param  t_values specifies the values, padded to a multiple of 64
+	*	@param  t_bits specifies the bitset. Bit i chooses value i.
+	*	@param  t_bytes specifies the number of bytes in the bitset
+	*	@param  t_simdLevel specifies the instruction set. The CPU must support it.
+	*	@return sum of the chosen values
+	*/
+	inline std::int64_t maskedSum(const std::int32_t* t_values, const unsigned char* t_bits, const std::size_t t_bytes, const SimdLevel t_simdLevel)
+	{
+#ifdef GA_SIMD_X86_
+		if (t_simdLevel == SimdLevel::avx2) {
+			return maskedSumAvx2(t_values, t_bits, t_bytes);
+		}
+#endif	// GA_SIMD_X86_
+		return maskedSumScalar(t_values, t_bits, t_bytes);
+	}
+
+	/**
+	*	@brief  Adds every value whose bit is set, using the fastest instruction set available.
+	*
+	*	@return sum of the chosen values
+	*/
+	inline std::int64_t maskedSum(const std::int32_t* t_values, const unsigned char* t_bits, const std::size_t t_bytes)
+	{
+		return maskedSum(t_values, t_bits, t_bytes, getSimdLevel());
+	}
+
+} // namespace ga
+
+#endif	// MASKED_SUM_KERNELS_H_
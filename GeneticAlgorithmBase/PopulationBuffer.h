@@ -0,0 +1,158 @@
+/**
+* @class PopulationBuffer.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains contiguous storage for the encoded data and scores of a whole population
+*
+* Encoded data is stored in one aligned block, with a fixed stride between Chromos.
+* Scores are stored in a separate dense array. Phases that walk the whole
+* population (sorting, crossover, file I/O) then read memory in order, rather than
+* following a pointer to a separate heap allocation for every Chromo.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef POPULATION_BUFFER_H_
+#define POPULATION_BUFFER_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+namespace ga
+{
+	class PopulationBuffer
+	{
+	public:
+		PopulationBuffer() {};
+		~PopulationBuffer()
+		{
+			delete[] m_rawData;
+		};
+
+		PopulationBuffer(const PopulationBuffer&) = delete;
+		PopulationBuffer& operator=(const PopulationBuffer&) = delete;
+
+		void allocate(const std::size_t, const std::size_t);
+		void release();
+		bool isAllocated() const;
+
+		char* getSlot(const std::size_t);
+		const char* getSlot(const std::size_t) const;
+		double* getScoreSlot(const std::size_t);
+		double getScore(const std::size_t) const;
+
+		std::size_t getSlotCount() const;
+		std::size_t getStride() const;
+
+		static std::size_t calculateStride(const std::size_t);
+
+		// Alignment of the block, and of every slot for large genomes
+		static const std::size_t alignment{ 64 };
+
+	private:
+		char* m_rawData{ nullptr };
+		// m_rawData rounded up to the alignment
+		char* m_data{ nullptr };
+		std::size_t m_slotCount{ 0 };
+		std::size_t m_stride{ 0 };
+		std::vector<double> m_scores;
+	};
+
+	/**
+	*	@brief  Allocates space for a population. Any previous space is released.
+	*	Slots and scores are set to 0.
+	*
+	*	@param  t_slotCount specifies the number of Chromos
+	*	@param  t_encodedSize specifies the number of encoded bytes per Chromo
+	*	@return void
+	*/
+	inline void PopulationBuffer::allocate(const std::size_t t_slotCount, const std::size_t t_encodedSize)
+	{
+		release();
+
+		m_slotCount = t_slotCount;
+		m_stride = calculateStride(t_encodedSize);
+
+		const std::size_t bytes{ m_slotCount * m_stride };
+		m_rawData = new char[bytes + alignment];
+		const std::uintptr_t address{ reinterpret_cast<std::uintptr_t>(m_rawData) };
+		m_data = m_rawData + (alignment - address % alignment) % alignment;
+		std::memset(m_data, 0, bytes);
+
+		m_scores.assign(m_slotCount, 0.0);
+	}
+
+	/**
+	*	@brief  Frees the space. Any EncodedData bound to a slot must be unbound first.
+	*
+	*	@return void
+	*/
+	inline void PopulationBuffer::release()
+	{
+		delete[] m_rawData;
+		m_rawData = nullptr;
+		m_data = nullptr;
+		m_slotCount = 0;
+		m_stride = 0;
+		m_scores.clear();
+	}
+
+	inline bool PopulationBuffer::isAllocated() const
+	{
+		return m_data != nullptr;
+	}
+
+	inline char* PopulationBuffer::getSlot(const std::size_t t_slot)
+	{
+		return m_data + t_slot * m_stride;
+	}
+
+	inline const char* PopulationBuffer::getSlot(const std::size_t t_slot) const
+	{
+		return m_data + t_slot * m_stride;
+	}
+
+	inline double* PopulationBuffer::getScoreSlot(const std::size_t t_slot)
+	{
+		return &m_scores[t_slot];
+	}
+
+	inline double PopulationBuffer::getScore(const std::size_t t_slot) const
+	{
+		return m_scores[t_slot];
+	}
+
+	inline std::size_t PopulationBuffer::getSlotCount() const
+	{
+		return m_slotCount;
+	}
+
+	inline std::size_t PopulationBuffer::getStride() const
+	{
+		return m_stride;
+	}
+
+	/**
+	*	@brief  Returns the number of bytes between slots.
+	*	Small genomes are padded to 16 bytes, so that millions of them
+	*	fit in memory. Larger genomes are padded to a full cache line,
+	*	so that no two Chromos share one.
+	*
+	*	@param  t_encodedSize specifies the number of encoded bytes per Chromo
+	*	@return stride in bytes
+	*/
+	inline std::size_t PopulationBuffer::calculateStride(const std::size_t t_encodedSize)
+	{
+		const std::size_t padding{ t_encodedSize >= alignment ? alignment : 16 };
+		const std::size_t stride{ (t_encodedSize + padding - 1) / padding * padding };
+		return stride > 0 ? stride : padding;
+	}
+
+} // namespace ga
+
+#endif	// POPULATION_BUFFER_H_
@@ -0,0 +1,466 @@
+/**
+* @class RandomGenerator.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a pluggable random number generator used by the GA, Chromos, and helper functions
+*
+* Each RandomGenerator is an independent stream with no shared state,
+* so GAs, Chromos, and threads can each own one and draw numbers in parallel.
+* Calling the generator like a function returns a non-negative int, just like rand(),
+* so code written as (m_randomGenerator() % 100) keeps working.
+*
+* Engines:
+*   - function: wraps a legacy int(*)(void) generator such as &rand
+*   - xoshiro256ss: xoshiro256** (fast, 256-bit state, jumpable by 2^128)
+*   - pcg32: PCG-XSH-RR (small state, 2^63 selectable streams)
+*
+* @see (link to GitHub)
+*/
+
+#ifndef RANDOM_GENERATOR_H_
+#define RANDOM_GENERATOR_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace ga
+{
+	enum class RandomEngine { function, xoshiro256ss, pcg32 };
+
+	class RandomGenerator
+	{
+	public:
+		// Not explicit, so existing code can still pass &rand
+		RandomGenerator(int(*t_function)(void))
+			: m_engine(RandomEngine::function),
+			m_function(t_function)
+		{ };
+
+		explicit RandomGenerator(const RandomEngine t_engine = RandomEngine::xoshiro256ss, const std::uint64_t t_seed = 0x853C49E6748FEA9BULL)
+			: m_engine(t_engine),
+			m_function(t_engine == RandomEngine::function ? &rand : nullptr)
+		{
+			seed(t_seed);
+		};
+
+		void seed(const std::uint64_t);
+
+		// Compatible with rand(): returns a number in [0, max()]
+		int operator()();
+		int max() const;
+
+		// Full-width draws
+		std::uint64_t nextU64();
+		std::uint32_t nextU32();
+		// Returns a double in [0, 1)
+		double nextDouble();
+		// Returns a number in [0, t_bound)
+		std::size_t nextIndex(const std::size_t t_bound);
+		// Returns the number of failed trials before the first success
+		double nextGeometric(const double t_logFailChance);
+
+		// Bulk draws
+		void fillUniformInts(int*, const std::size_t, const int, const int);
+		void fillUniformDoubles(double*, const std::size_t);
+		void fillRandomBits(unsigned char*, const std::size_t);
+
+		// Independent streams
+		void jump();
+		RandomGenerator split();
+
+		RandomEngine getEngine() const;
+
+		// Saving and restoring a stream (see Checkpoint.h)
+		void getState(std::uint64_t(&)[4]) const;
+		void setState(const std::uint64_t(&)[4]);
+
+	private:
+		std::uint64_t nextXoshiro();
+		std::uint32_t nextPcg();
+		std::uint64_t nextFromFunction();
+		static std::uint64_t splitMix(std::uint64_t&);
+
+		RandomEngine m_engine;
+		int(*m_function)(void);
+
+		// xoshiro256** uses all 4 words
+		// pcg32 uses [0] as state and [1] as stream increment
+		std::uint64_t m_state[4]{ 0, 0, 0, 0 };
+	};
+
+	/**
+	*	@brief  Sets the engine state from a single seed value.
+	*	A SplitMix64 generator expands the seed, so similar seeds
+	*	still produce unrelated streams.
+	*
+	*	@param  t_seed is the new seed
+	*	@return void
+	*/
+	inline void RandomGenerator::seed(const std::uint64_t t_seed)
+	{
+		std::uint64_t mix{ t_seed };
+		if (m_engine == RandomEngine::xoshiro256ss) {
+			for (std::size_t i{ 0 }; i < 4; ++i) {
+				m_state[i] = splitMix(mix);
+			}
+		}
+		else if (m_engine == RandomEngine::pcg32) {
+			// Increment must be odd
+			m_state[1] = splitMix(mix) | 1;
+			m_state[0] = 0;
+			nextPcg();
+			m_state[0] += splitMix(mix);
+			nextPcg();
+		}
+		else if (m_engine == RandomEngine::function && m_function == &rand) {
+			srand(static_cast<unsigned int>(t_seed));
+		}
+	}
+
+	/**
+	*	@brief  Returns a random non-negative int in [0, max()], like rand().
+	*
+	*	@return Random int
+	*/
+	inline int RandomGenerator::operator()()
+	{
+		if (m_engine == RandomEngine::function) {
+			return m_function();
+		}
+		return static_cast<int>(nextU64() >> 33);
+	}
+
+	/**
+	*	@brief  Returns the largest value operator() can return.
+	*
+	*	@return RAND_MAX for wrapped functions, 2^31 - 1 otherwise
+	*/
+	inline int RandomGenerator::max() const
+	{
+		return m_engine == RandomEngine::function ? RAND_MAX : 0x7FFFFFFF;
+	}
+
+	/**
+	*	@brief  Returns 64 random bits.
+	*
+	*	@return Random 64-bit number
+	*/
+	inline std::uint64_t RandomGenerator::nextU64()
+	{
+		if (m_engine == RandomEngine::xoshiro256ss) {
+			return nextXoshiro();
+		}
+		else if (m_engine == RandomEngine::pcg32) {
+			const std::uint64_t high{ nextPcg() };
+			return (high << 32) | nextPcg();
+		}
+		return nextFromFunction();
+	}
+
+	/**
+	*	@brief  Returns 32 random bits.
+	*
+	*	@return Random 32-bit number
+	*/
+	inline std::uint32_t RandomGenerator::nextU32()
+	{
+		if (m_engine == RandomEngine::pcg32) {
+			return nextPcg();
+		}
+		return static_cast<std::uint32_t>(nextU64() >> 32);
+	}
+
+	/**
+	*	@brief  Returns a random double in the range [0, 1).
+	*	Uses the top 53 bits, so every result is equally likely.
+	*
+	*	@return Random double
+	*/
+	inline double RandomGenerator::nextDouble()
+	{
+		return static_cast<double>(nextU64() >> 11) * (1.0 / 9007199254740992.0);
+	}
+
+	/**
+	*	@brief  Returns a random index in the range [0, t_bound).
+	*	Uses Lemire's multiply-shift method for 32-bit bounds, which
+	*	avoids the division and the bias of (rand() % t_bound).
+	*
+	*	@param  t_bound is the number of possible results. Must be greater than 0;
+	*	there is no valid result for 0, so callers must check for it first.
+	*	@return Random index
+	*/
+	inline std::size_t RandomGenerator::nextIndex(const std::size_t t_bound)
+	{
+		assert(t_bound > 0 && "nextIndex() needs at least 1 possible result");
+		if (t_bound <= 0xFFFFFFFFULL) {
+			const std::uint32_t bound{ static_cast<std::uint32_t>(t_bound) };
+			std::uint64_t product{ static_cast<std::uint64_t>(nextU32()) * bound };
+			std::uint32_t low{ static_cast<std::uint32_t>(product) };
+			if (low < bound) {
+				// Reject the few results that would be biased
+				const std::uint32_t threshold{ static_cast<std::uint32_t>(0 - bound) % bound };
+				while (low < threshold) {
+					product = static_cast<std::uint64_t>(nextU32()) * bound;
+					low = static_cast<std::uint32_t>(product);
+				}
+			}
+			return static_cast<std::size_t>(product >> 32);
+		}
+		return static_cast<std::size_t>(nextU64() % t_bound);
+	}
+
+	/**
+	*	@brief  Returns the number of failed trials before the first success,
+	*	where each trial succeeds with the same chance p.
+	*	Uses inversion, floor(log(u) / log(1 - p)), so a single draw replaces
+	*	every trial that would have been rolled separately.
+	*
+	*	@param  t_logFailChance is log(1 - p), which must be negative. Use std::log1p(-p).
+	*	@return Number of failures, as a whole number. May be larger than any std::size_t.
+	*/
+	inline double RandomGenerator::nextGeometric(const double t_logFailChance)
+	{
+		// 1 - nextDouble() is in (0, 1], so the log is finite
+		return std::floor(std::log(1.0 - nextDouble()) / t_logFailChance);
+	}
+
+	/**
+	*	@brief  Fills an array with random ints in the range [t_min, t_max).
+	*
+	*	@param  t_out specifies the array to fill
+	*	@param  t_count specifies the number of values to write
+	*	@param  t_min specifies the minimum value to allow
+	*	@param  t_max specifies the maximum value (exclusive). Must be greater than t_min.
+	*	@return void
+	*/
+	inline void RandomGenerator::fillUniformInts(int* t_out, const std::size_t t_count, const int t_min, const int t_max)
+	{
+		const std::size_t range{ static_cast<std::size_t>(static_cast<long long>(t_max) - t_min) };
+		for (std::size_t i{ 0 }; i < t_count; ++i) {
+			t_out[i] = static_cast<int>(static_cast<long long>(nextIndex(range)) + t_min);
+		}
+	}
+
+	/**
+	*	@brief  Fills an array with random doubles in the range [0, 1).
+	*
+	*	@param  t_out specifies the array to fill
+	*	@param  t_count specifies the number of values to write
+	*	@return void
+	*/
+	inline void RandomGenerator::fillUniformDoubles(double* t_out, const std::size_t t_count)
+	{
+		for (std::size_t i{ 0 }; i < t_count; ++i) {
+			t_out[i] = nextDouble();
+		}
+	}
+
+	/**
+	*	@brief  Fills a byte array with random bits, 8 bytes per engine step.
+	*	This is meant for crossover and mutation kernels that need
+	*	one random bit per byte or per bit of encoded data.
+	*
+	*	@param  t_out specifies the byte array to fill
+	*	@param  t_bytes specifies the number of bytes to write
+	*	@return void
+	*/
+	inline void RandomGenerator::fillRandomBits(unsigned char* t_out, const std::size_t t_bytes)
+	{
+		std::size_t i{ 0 };
+		for (; i + 8 <= t_bytes; i += 8) {
+			const std::uint64_t bits{ nextU64() };
+			std::memcpy(t_out + i, &bits, 8);
+		}
+		if (i < t_bytes) {
+			const std::uint64_t bits{ nextU64() };
+			std::memcpy(t_out + i, &bits, t_bytes - i);
+		}
+	}
+
+	/**
+	*	@brief  Advances this stream far enough that it will never overlap the numbers it would have produced.
+	*	xoshiro256** jumps ahead 2^128 steps. pcg32 jumps ahead 2^48 steps.
+	*	Wrapped functions cannot jump, so nothing happens.
+	*
+	*	@return void
+	*/
+	inline void RandomGenerator::jump()
+	{
+		if (m_engine == RandomEngine::xoshiro256ss)
+		{
+			static const std::uint64_t jumpTable[4]{ 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+			std::uint64_t jumped[4]{ 0, 0, 0, 0 };
+			for (std::size_t i{ 0 }; i < 4; ++i) {
+				for (std::size_t bit{ 0 }; bit < 64; ++bit) {
+					if (jumpTable[i] & (static_cast<std::uint64_t>(1) << bit)) {
+						for (std::size_t word{ 0 }; word < 4; ++word) {
+							jumped[word] ^= m_state[word];
+						}
+					}
+					nextXoshiro();
+				}
+			}
+			std::memcpy(m_state, jumped, sizeof(m_state));
+		}
+		else if (m_engine == RandomEngine::pcg32)
+		{
+			// LCG jump ahead in O(log n) steps (Brown, "Random Number Generation with Arbitrary Strides")
+			std::uint64_t steps{ static_cast<std::uint64_t>(1) << 48 };
+			std::uint64_t curMult{ 6364136223846793005ULL };
+			std::uint64_t curPlus{ m_state[1] };
+			std::uint64_t accMult{ 1 };
+			std::uint64_t accPlus{ 0 };
+			while (steps > 0) {
+				if (steps & 1) {
+					accMult *= curMult;
+					accPlus = accPlus * curMult + curPlus;
+				}
+				curPlus = (curMult + 1) * curPlus;
+				curMult *= curMult;
+				steps >>= 1;
+			}
+			m_state[0] = accMult * m_state[0] + accPlus;
+		}
+	}
+
+	/**
+	*	@brief  Returns a new, independent stream and moves this stream past it.
+	*	Use this to hand out a separate stream to each thread or Chromo.
+	*	xoshiro256** streams are 2^128 steps apart. pcg32 streams
+	*	use a different increment, so their sequences never coincide.
+	*	Wrapped functions share the same function.
+	*
+	*	@return New generator
+	*/
+	inline RandomGenerator RandomGenerator::split()
+	{
+		RandomGenerator stream(*this);
+		if (m_engine == RandomEngine::xoshiro256ss) {
+			jump();
+		}
+		else if (m_engine == RandomEngine::pcg32) {
+			std::uint64_t mix{ nextU64() };
+			stream.m_state[1] = splitMix(mix) | 1;
+			stream.m_state[0] = splitMix(mix);
+		}
+		return stream;
+	}
+
+	/**
+	*	@brief  Returns the engine used by this generator.
+	*
+	*	@return m_engine
+	*/
+	inline RandomEngine RandomGenerator::getEngine() const
+	{
+		return m_engine;
+	}
+
+	/**
+	*	@brief  Copies the engine state, so the stream can be continued later with setState().
+	*	Wrapped functions have no state here, so their state is all zeros.
+	*
+	*	@param  t_state is set to the engine state
+	*	@return void
+	*/
+	inline void RandomGenerator::getState(std::uint64_t(&t_state)[4]) const
+	{
+		for (std::size_t i{ 0 }; i < 4; ++i) {
+			t_state[i] = m_state[i];
+		}
+	}
+
+	/**
+	*	@brief  Replaces the engine state with one saved by getState() from a generator with the same engine.
+	*
+	*	@param  t_state specifies the saved engine state
+	*	@return void
+	*/
+	inline void RandomGenerator::setState(const std::uint64_t(&t_state)[4])
+	{
+		for (std::size_t i{ 0 }; i < 4; ++i) {
+			m_state[i] = t_state[i];
+		}
+	}
+
+	/**
+	*	@brief  Advances xoshiro256** by one step.
+	*
+	*	@return Next 64-bit output
+	*/
+	inline std::uint64_t RandomGenerator::nextXoshiro()
+	{
+		const std::uint64_t result{ ((m_state[1] * 5) << 7 | (m_state[1] * 5) >> 57) * 9 };
+		const std::uint64_t t{ m_state[1] << 17 };
+
+		m_state[2] ^= m_state[0];
+		m_state[3] ^= m_state[1];
+		m_state[1] ^= m_state[2];
+		m_state[0] ^= m_state[3];
+		m_state[2] ^= t;
+		m_state[3] = (m_state[3] << 45) | (m_state[3] >> 19);
+
+		return result;
+	}
+
+	/**
+	*	@brief  Advances pcg32 by one step.
+	*
+	*	@return Next 32-bit output
+	*/
+	inline std::uint32_t RandomGenerator::nextPcg()
+	{
+		const std::uint64_t oldState{ m_state[0] };
+		m_state[0] = oldState * 6364136223846793005ULL + m_state[1];
+		const std::uint32_t xorShifted{ static_cast<std::uint32_t>(((oldState >> 18) ^ oldState) >> 27) };
+		const std::uint32_t rotation{ static_cast<std::uint32_t>(oldState >> 59) };
+		return (xorShifted >> rotation) | (xorShifted << ((0 - rotation) & 31));
+	}
+
+	/**
+	*	@brief  Builds 64 random bits out of several calls to a wrapped function.
+	*	Functions like rand() may only return 15 bits at a time,
+	*	so calls are combined until 64 bits have been filled.
+	*
+	*	@return Random 64-bit number
+	*/
+	inline std::uint64_t RandomGenerator::nextFromFunction()
+	{
+		// Count whole bits returned per call
+		std::size_t bitsPerCall{ 0 };
+		for (unsigned long long maxValue{ static_cast<unsigned long long>(RAND_MAX) }; maxValue & 1; maxValue >>= 1) {
+			++bitsPerCall;
+		}
+
+		std::uint64_t result{ 0 };
+		for (std::size_t bits{ 0 }; bits < 64; bits += bitsPerCall) {
+			result = (result << bitsPerCall) ^ static_cast<std::uint64_t>(m_function());
+		}
+		return result;
+	}
+
+	/**
+	*	@brief  SplitMix64, used to expand seeds into full engine states.
+	*
+	*	@param  t_state is the SplitMix state, which is advanced
+	*	@return Next 64-bit output
+	*/
+	inline std::uint64_t RandomGenerator::splitMix(std::uint64_t& t_state)
+	{
+		std::uint64_t z{ (t_state += 0x9E3779B97F4A7C15ULL) };
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+
+} // namespace ga
+
+#endif	// RANDOM_GENERATOR_H_
@@ -0,0 +1,130 @@
+/**
+* @class ScoreSelection.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains functions for finding the top scoring Chromos using a dense array of score keys
+*
+* Selection works on (score, index) pairs stored next to each other in memory,
+* rather than following a pointer to every Chromo inside a comparison.
+* Only the keys are moved. The caller then reorders its Chromo pointers to match.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef SCORE_SELECTION_H_
+#define SCORE_SELECTION_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <algorithm>
+#include <cstddef>
+
+#include "ThreadPool.h"
+
+namespace ga
+{
+	// A fitness score and the position of its Chromo
+	struct ScoreKey
+	{
+		double score;
+		std::size_t index;
+	};
+
+	/**
+	*	@brief  Orders score keys from best to worst.
+	*	Equal scores are ordered by index, so the top keys are always
+	*	the same set, no matter how the search was split up.
+	*
+	*	@param  t_key1 specifies the first key
+	*	@param  t_key2 specifies the second key
+	*	@return true if t_key1 comes before t_key2
+	*/
+	inline bool isBetterScoreKey(const ScoreKey& t_key1, const ScoreKey& t_key2)
+	{
+		if (t_key1.score != t_key2.score) {
+			return t_key1.score > t_key2.score;
+		}
+		return t_key1.index < t_key2.index;
+	}
+
+	/**
+	*	@brief  Moves the t_topCount best keys in [t_first, t_last) to the front of the range.
+	*	Uses nth_element, which takes O(n) time. When only a few keys are
+	*	wanted, a partial sort is faster, since most keys are rejected after
+	*	a single comparison with the worst of the best keys found so far.
+	*
+	*	@param  t_first points to the first key
+	*	@param  t_last points past the last key
+	*	@param  t_topCount specifies the number of best keys to find
+	*	@return void
+	*/
+	inline void partitionTopScoreKeys(ScoreKey* t_first, ScoreKey* t_last, const std::size_t t_topCount)
+	{
+		const std::size_t count{ static_cast<std::size_t>(t_last - t_first) };
+		if (t_topCount >= count) {
+			return;
+		}
+		if (t_topCount <= count / 64) {
+			std::partial_sort(t_first, t_first + t_topCount, t_last, isBetterScoreKey);
+		}
+		else {
+			std::nth_element(t_first, t_first + t_topCount, t_last, isBetterScoreKey);
+		}
+	}
+
+	/**
+	*	@brief  Fills an array of score keys, then moves the t_topCount best keys to the front, in no particular order.
+	*	See partitionTopScoreKeys().
+	*
+	*	If a thread pool is given, the keys are split into one chunk per
+	*	thread. Each thread fills its chunk and finds the chunk's best keys,
+	*	then the best of those are found on the calling thread. This is only
+	*	done when each chunk holds at least twice t_topCount keys, so it
+	*	suits picking a small number of Elite Chromos from a large generation.
+	*
+	*	@param  t_keys points to the first key
+	*	@param  t_count specifies the number of keys
+	*	@param  t_topCount specifies the number of best keys to find
+	*	@param  t_fillKeys is called as t_fillKeys(first, last) to fill keys [first, last)
+	*	@param  t_threadPool specifies the threads to use, or nullptr to run on the calling thread
+	*	@return void
+	*/
+	template <typename F>
+	void selectTopScoreKeys(ScoreKey* t_keys, const std::size_t t_count, const std::size_t t_topCount, F& t_fillKeys, ThreadPool* t_threadPool)
+	{
+		const std::size_t threadCount{ t_threadPool ? t_threadPool->getThreadCount() : 1 };
+		const std::size_t chunkSize{ (t_count + threadCount - 1) / threadCount };
+
+		if (threadCount > 1 && t_topCount > 0 && chunkSize >= 2 * t_topCount)
+		{
+			auto selectChunk = [t_keys, t_topCount, &t_fillKeys](const std::size_t t_first, const std::size_t t_last)
+			{
+				t_fillKeys(t_first, t_last);
+				partitionTopScoreKeys(t_keys + t_first, t_keys + t_last, t_topCount);
+			};
+			t_threadPool->parallelFor(t_count, chunkSize, selectChunk);
+
+			// Swap the best keys of each chunk to the front
+			// Chunks hold at least twice t_topCount keys, so a chunk's best keys
+			// are never swapped over the best keys of a later chunk
+			std::size_t candidateCount{ std::min(t_topCount, t_count) };
+			for (std::size_t first{ chunkSize }; first < t_count; first += chunkSize)
+			{
+				const std::size_t chunkTopCount{ std::min(t_topCount, t_count - first) };
+				std::swap_ranges(t_keys + first, t_keys + first + chunkTopCount, t_keys + candidateCount);
+				candidateCount += chunkTopCount;
+			}
+
+			partitionTopScoreKeys(t_keys, t_keys + candidateCount, t_topCount);
+			return;
+		}
+
+		t_fillKeys(static_cast<std::size_t>(0), t_count);
+		partitionTopScoreKeys(t_keys, t_keys + t_count, t_topCount);
+	}
+
+} // namespace ga
+
+#endif	// SCORE_SELECTION_H_
@@ -0,0 +1,108 @@
+#include "ThreadPool.h"
+
+namespace ga
+{
+	/**
+	*	@brief  Starts the worker threads.
+	*	The thread calling parallelFor() also works on jobs, so
+	*	(t_threadCount - 1) workers are created.
+	*
+	*	@param  t_threadCount is the total number of threads to use. 0 uses the hardware thread count.
+	*/
+	ThreadPool::ThreadPool(const std::size_t t_threadCount)
+	{
+		const std::size_t threadCount{ t_threadCount > 0 ? t_threadCount : getDefaultThreadCount() };
+		m_workers.reserve(threadCount - 1);
+		for (std::size_t i{ 1 }; i < threadCount; ++i) {
+			m_workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+		}
+	}
+
+	/**
+	*	@brief  Wakes all workers so they can exit, then joins them.
+	*/
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_isStopping = true;
+		}
+		m_jobReady.notify_all();
+
+		for (auto& worker : m_workers) {
+			worker.join();
+		}
+	}
+
+	/**
+	*	@brief  Returns the number of threads that work on each job.
+	*
+	*	@return Worker count plus the calling thread
+	*/
+	std::size_t ThreadPool::getThreadCount() const
+	{
+		return m_workers.size() + 1;
+	}
+
+	/**
+	*	@brief  Returns the number of hardware threads, or 1 if that is unknown.
+	*
+	*	@return Default thread count
+	*/
+	std::size_t ThreadPool::getDefaultThreadCount()
+	{
+		const unsigned int hardwareThreads{ std::thread::hardware_concurrency() };
+		return hardwareThreads > 0 ? hardwareThreads : 1;
+	}
+
+	/**
+	*	@brief  Main loop for worker threads. Sleeps until a job is posted, works on it, then sleeps again.
+	*
+	*	@return void
+	*/
+	void ThreadPool::workerLoop()
+	{
+		unsigned long int lastJobId{ 0 };
+
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_jobReady.wait(lock, [this, lastJobId] { return m_isStopping || m_jobId != lastJobId; });
+				if (m_isStopping) {
+					return;
+				}
+				lastJobId = m_jobId;
+			}
+
+			runChunks();
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				--m_busyWorkers;
+				if (m_busyWorkers == 0) {
+					m_jobFinished.notify_one();
+				}
+			}
+		}
+	}
+
+	/**
+	*	@brief  Claims and runs chunks of the current job until none are left.
+	*
+	*	@return void
+	*/
+	void ThreadPool::runChunks()
+	{
+		while (true)
+		{
+			const std::size_t first{ m_nextIndex.fetch_add(m_jobChunkSize) };
+			if (first >= m_jobCount) {
+				return;
+			}
+			const std::size_t last{ first + m_jobChunkSize < m_jobCount ? first + m_jobChunkSize : m_jobCount };
+			m_jobInvoke(m_jobContext, first, last);
+		}
+	}
+
+} // namespace ga
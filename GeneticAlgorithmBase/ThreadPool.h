@@ -0,0 +1,138 @@
+/**
+* @class ThreadPool.h
+* @author Bryan Franz
+* @date October 16, 2026
+* @brief Contains a persistent pool of worker threads used to split GA phases across cores
+*
+* Threads are created once, when the pool is constructed, and sleep between jobs.
+* This means running a parallel phase every generation does not create new threads.
+*
+* @see (link to GitHub)
+*/
+
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#ifdef _MSC_VER
+#pragma once
+#endif	// _MSC_VER
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace ga
+{
+	class ThreadPool
+	{
+	public:
+		explicit ThreadPool(const std::size_t t_threadCount);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		// Number of threads working on each job,
+		// including the thread that calls parallelFor()
+		std::size_t getThreadCount() const;
+
+		// Splits [0, t_count) into chunks and runs t_function(first, last) on each chunk
+		template <typename F>
+		void parallelFor(const std::size_t t_count, const std::size_t t_chunkSize, F& t_function);
+
+		static std::size_t getDefaultThreadCount();
+
+	private:
+		void workerLoop();
+		void runChunks();
+
+		template <typename F>
+		static void invokeJob(void*, const std::size_t, const std::size_t);
+
+		std::vector<std::thread> m_workers;
+
+		std::mutex m_mutex;
+		std::condition_variable m_jobReady;
+		std::condition_variable m_jobFinished;
+
+		// Current job
+		// The job is stored as a plain function pointer and context
+		// so that starting a job does not allocate memory
+		void* m_jobContext{ nullptr };
+		void (*m_jobInvoke)(void*, const std::size_t, const std::size_t){ nullptr };
+		std::size_t m_jobCount{ 0 };
+		std::size_t m_jobChunkSize{ 1 };
+		std::atomic<std::size_t> m_nextIndex{ 0 };
+
+		// Incremented for every job, so sleeping workers know a new job is ready
+		unsigned long int m_jobId{ 0 };
+		// Workers which have not yet finished the current job
+		std::size_t m_busyWorkers{ 0 };
+		bool m_isStopping{ false };
+	};
+
+	/**
+	*	@brief  Runs a function over a range of indices, using every thread in the pool.
+	*	The range is split into chunks of t_chunkSize indices. Threads
+	*	take the next unclaimed chunk until none are left, so uneven
+	*	chunks are balanced automatically. The calling thread works
+	*	on chunks as well, and this method returns once every chunk is done.
+	*
+	*	@param  t_count specifies the number of indices to process
+	*	@param  t_chunkSize specifies the number of indices handed to a thread at a time
+	*	@param  t_function is called as t_function(first, last) for each chunk
+	*	@return void
+	*/
+	template <typename F>
+	void ThreadPool::parallelFor(const std::size_t t_count, const std::size_t t_chunkSize, F& t_function)
+	{
+		if (t_count == 0) {
+			return;
+		}
+
+		const std::size_t chunkSize{ t_chunkSize > 0 ? t_chunkSize : 1 };
+
+		// Not worth waking the workers for a single chunk
+		if (m_workers.empty() || t_count <= chunkSize) {
+			t_function(static_cast<std::size_t>(0), t_count);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_jobContext = &t_function;
+			m_jobInvoke = &ThreadPool::invokeJob<F>;
+			m_jobCount = t_count;
+			m_jobChunkSize = chunkSize;
+			m_nextIndex.store(0);
+			m_busyWorkers = m_workers.size();
+			++m_jobId;
+		}
+		m_jobReady.notify_all();
+
+		// Help out
+		runChunks();
+
+		// Wait for the workers to finish their last chunks
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_jobFinished.wait(lock, [this] { return m_busyWorkers == 0; });
+		m_jobContext = nullptr;
+		m_jobInvoke = nullptr;
+	}
+
+	/**
+	*	@brief  Casts the job context back to its real type and calls it.
+	*
+	*	@return void
+	*/
+	template <typename F>
+	void ThreadPool::invokeJob(void* t_context, const std::size_t t_first, const std::size_t t_last)
+	{
+		(*static_cast<F*>(t_context))(t_first, t_last);
+	}
+
+} // namespace ga
+
+#endif	// THREAD_POOL_H_
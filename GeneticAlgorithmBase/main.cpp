@@ -25,9 +25,10 @@ int main()
 	
 	cout << "Genetic Algorithm Testing\n\n";
 
-	srand(time(NULL));
+	// Seeded generator, split into an independent stream for every Chromo
+	ga::RandomGenerator randomGenerator(ga::RandomEngine::xoshiro256ss, static_cast<std::uint64_t>(time(NULL)));
 
-	//ga::runTestGenerations<ga::ChromoTestFeatures>(&rand);
+	//ga::runTestGenerations<ga::ChromoTestFeatures>(randomGenerator);
 	//cin.get();
 	
 	/*
@@ -72,7 +73,7 @@ int main()
 
 	cin.get();*/
 
-	ga::GeneticAlgorithm<ga::ChromoTestFeatures>* ga1 = new ga::GeneticAlgorithm<ga::ChromoTestFeatures>("Test A", 10, 0, &rand);
+	ga::GeneticAlgorithm<ga::ChromoTestFeatures>* ga1 = new ga::GeneticAlgorithm<ga::ChromoTestFeatures>("Test A", 10, 0, randomGenerator);
 	
 	ga1->setNumberToCopy(2);
 	ga1->setNumberToShuffle(2);